@@ -1,4 +1,9 @@
+#include <complexities/deque_analyzer.h>
+#include <complexities/hierarchy_analyzer.h>
 #include <complexities/list_analyzer.h>
+#include <complexities/network_analyzer.h>
+#include <complexities/queue_analyzer.h>
+#include <complexities/table_analyzer.h>
 #include <tests/root.h>
 
 #ifndef ANALYZER_OUTPUT
@@ -14,6 +19,7 @@ std::vector<std::unique_ptr<ds::tests::Test>> createTests() {
   mm->add_test(std::make_unique<ds::tests::MemoryManagerTest>());
 
   mm->add_test(std::make_unique<ds::tests::CompactMemoryManagerTest>());
+  mm->add_test(std::make_unique<ds::tests::PoolMemoryManagerTest>());
 
   amt->add_test(std::make_unique<ds::tests::ImplicitSequenceTest>());
 
@@ -22,7 +28,10 @@ std::vector<std::unique_ptr<ds::tests::Test>> createTests() {
   amt->add_test(std::make_unique<ds::tests::ImplicitHierarchyTest>());
 
   amt->add_test(std::make_unique<ds::tests::ExplicitHierarchyTest>());
+  amt->add_test(std::make_unique<ds::tests::FrozenHierarchyTest>());
   amt->add_test(std::make_unique<ds::tests::HierarchyTest>());
+  amt->add_test(std::make_unique<ds::tests::ExplicitNetworkTest>());
+  amt->add_test(std::make_unique<ds::tests::FrozenNetworkTest>());
 
   adt->add_test(std::make_unique<ds::tests::ListTest>());
   adt->add_test(std::make_unique<ds::tests::ArraysTest>());
@@ -36,6 +45,7 @@ std::vector<std::unique_ptr<ds::tests::Test>> createTests() {
   adt->add_test(std::make_unique<ds::tests::NonSequenceTableTest>());
 
   adt->add_test(std::make_unique<ds::tests::SortTest>());
+  adt->add_test(std::make_unique<ds::tests::NetworkAlgorithmsTest>());
 
   root->add_test(std::move(mm));
   root->add_test(std::move(amt));
@@ -49,6 +59,11 @@ std::vector<std::unique_ptr<ds::utils::Analyzer>> createAnalyzers() {
   std::vector<std::unique_ptr<ds::utils::Analyzer>> analyzers;
 
   analyzers.emplace_back(std::make_unique<ds::utils::ListsAnalyzer>());
+  analyzers.emplace_back(std::make_unique<ds::utils::HierarchiesAnalyzer>());
+  analyzers.emplace_back(std::make_unique<ds::utils::NetworksAnalyzer>());
+  analyzers.emplace_back(std::make_unique<ds::utils::QueuesAnalyzer>());
+  analyzers.emplace_back(std::make_unique<ds::utils::WorkStealingDequesAnalyzer>());
+  analyzers.emplace_back(std::make_unique<ds::utils::TablesAnalyzer>());
 
   return analyzers;
 }
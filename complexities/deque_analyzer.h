@@ -0,0 +1,117 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/work_stealing_deque.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Analyzes how draining a work-stealing deque scales with the number of threads.
+     *
+     * The deque is filled with tasks, then the calling thread pops them as the owner while
+     * threadCount - 1 thieves steal them, until the deque is empty. Each task performs
+     * TASK_ITERATIONS arithmetic steps.
+     */
+    class WorkStealingDequeAnalyzer : public ComplexityAnalyzer<adt::WorkStealingDeque<int>>
+    {
+    public:
+        WorkStealingDequeAnalyzer(const std::string& name, size_t threadCount);
+
+    protected:
+        void growToSize(adt::WorkStealingDeque<int>& structure, size_t size) override;
+        void executeOperation(adt::WorkStealingDeque<int>& structure) override;
+
+    private:
+        static void runTask(int task);
+
+    private:
+        static const int TASK_ITERATIONS = 200;
+
+        size_t threadCount_;
+    };
+
+    /**
+     * @brief Container for all work-stealing analyzers.
+     */
+    class WorkStealingDequesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        WorkStealingDequesAnalyzer();
+    };
+
+    //----------
+
+    inline WorkStealingDequeAnalyzer::WorkStealingDequeAnalyzer(const std::string& name, size_t threadCount) :
+        ComplexityAnalyzer<adt::WorkStealingDeque<int>>(name),
+        threadCount_(threadCount)
+    {
+    }
+
+    inline void WorkStealingDequeAnalyzer::growToSize(adt::WorkStealingDeque<int>& structure, size_t size)
+    {
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            structure.push(static_cast<int>(i));
+        }
+    }
+
+    inline void WorkStealingDequeAnalyzer::executeOperation(adt::WorkStealingDeque<int>& structure)
+    {
+        std::vector<std::thread> thieves;
+        thieves.reserve(threadCount_ - 1);
+        for (size_t t = 1; t < threadCount_; ++t)
+        {
+            thieves.emplace_back([&structure]()
+                {
+                    int task;
+                    while (!structure.isEmpty())
+                    {
+                        if (structure.steal(task))
+                        {
+                            runTask(task);
+                        }
+                    }
+                });
+        }
+
+        int task;
+        while (!structure.isEmpty())
+        {
+            if (structure.tryPop(task))
+            {
+                runTask(task);
+            }
+        }
+
+        for (std::thread& thief : thieves)
+        {
+            thief.join();
+        }
+    }
+
+    inline void WorkStealingDequeAnalyzer::runTask(int task)
+    {
+        volatile int result = task;
+        for (int i = 0; i < TASK_ITERATIONS; ++i)
+        {
+            result = result * 31 + i;
+        }
+    }
+
+    //----------
+
+    inline WorkStealingDequesAnalyzer::WorkStealingDequesAnalyzer() :
+        CompositeAnalyzer("WorkStealingDeques")
+    {
+        const size_t maxThreadCount = std::max<size_t>(2, std::thread::hardware_concurrency());
+        for (size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+        {
+            this->addAnalyzer(std::make_unique<WorkStealingDequeAnalyzer>("work-stealing-deque-" + std::to_string(threadCount) + "-threads", threadCount));
+        }
+    }
+}
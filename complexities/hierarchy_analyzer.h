@@ -0,0 +1,114 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/amt/explicit_hierarchy.h>
+#include <random>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Common base for hierarchy analyzers.
+     *
+     * Grows a random hierarchy where each new node becomes the last son
+     * of a uniformly chosen existing node.
+     */
+    template<class Hierarchy>
+    class HierarchyAnalyzer : public ComplexityAnalyzer<Hierarchy>
+    {
+    protected:
+        using BlockType = typename Hierarchy::BlockType;
+
+        explicit HierarchyAnalyzer(const std::string& name);
+
+    protected:
+        void growToSize(Hierarchy& structure, size_t size) override;
+
+    private:
+        std::default_random_engine rngData_;
+        std::default_random_engine rngParent_;
+        std::vector<BlockType*> nodes_;
+    };
+
+    /**
+     * @brief Analyzes complexity of a full pre-order traversal.
+     */
+    template<class Hierarchy>
+    class HierarchyPreOrderAnalyzer : public HierarchyAnalyzer<Hierarchy>
+    {
+    public:
+        explicit HierarchyPreOrderAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Hierarchy& structure) override;
+
+    private:
+        long long checksum_;
+    };
+
+    /**
+     * @brief Container for all hierarchy analyzers.
+     */
+    class HierarchiesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        HierarchiesAnalyzer();
+    };
+
+    //----------
+
+    template<class Hierarchy>
+    HierarchyAnalyzer<Hierarchy>::HierarchyAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Hierarchy>(name),
+        rngData_(144),
+        rngParent_(144)
+    {
+    }
+
+    template<class Hierarchy>
+    void HierarchyAnalyzer<Hierarchy>::growToSize(Hierarchy& structure, size_t size)
+    {
+        if (structure.isEmpty())
+        {
+            nodes_.clear();
+            structure.emplaceRoot().data_ = static_cast<int>(rngData_());
+            nodes_.push_back(structure.accessRoot());
+        }
+
+        while (nodes_.size() < size)
+        {
+            std::uniform_int_distribution<size_t> parentDist(0, nodes_.size() - 1);
+            BlockType& parent = *nodes_[parentDist(rngParent_)];
+            BlockType& son = structure.emplaceSon(parent, structure.degree(parent));
+            son.data_ = static_cast<int>(rngData_());
+            nodes_.push_back(&son);
+        }
+    }
+
+    //----------
+
+    template<class Hierarchy>
+    HierarchyPreOrderAnalyzer<Hierarchy>::HierarchyPreOrderAnalyzer(const std::string& name) :
+        HierarchyAnalyzer<Hierarchy>(name),
+        checksum_(0)
+    {
+    }
+
+    template<class Hierarchy>
+    void HierarchyPreOrderAnalyzer<Hierarchy>::executeOperation(Hierarchy& structure)
+    {
+        structure.processPreOrder(structure.accessRoot(), [this](const auto* node)
+            {
+                checksum_ += node->data_;
+            });
+    }
+
+    //----------
+
+    inline HierarchiesAnalyzer::HierarchiesAnalyzer() :
+        CompositeAnalyzer("Hierarchies")
+    {
+        this->addAnalyzer(std::make_unique<HierarchyPreOrderAnalyzer<amt::MultiWayEH<int>>>("mweh-pre-order"));
+        this->addAnalyzer(std::make_unique<HierarchyPreOrderAnalyzer<amt::MultiWaySiblingEH<int>>>("mwseh-pre-order"));
+    }
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/network_algorithms.h>
+#include <libds/amt/explicit_network.h>
+#include <libds/amt/frozen_network.h>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Common base for network analyzers.
+     *
+     * Grows a random network where each new node is connected
+     * to two uniformly chosen existing nodes.
+     */
+    template<class Network>
+    class NetworkAnalyzer : public ComplexityAnalyzer<Network>
+    {
+    protected:
+        using NodeType = typename Network::NodeType;
+
+        explicit NetworkAnalyzer(const std::string& name);
+
+    protected:
+        void growToSize(Network& structure, size_t size) override;
+
+    private:
+        static const size_t RELATIONS_PER_NODE = 2;
+
+        std::default_random_engine rngData_;
+        std::default_random_engine rngNode_;
+        std::vector<NodeType*> nodes_;
+    };
+
+    /**
+     * @brief Analyzes complexity of assigning the whole network.
+     */
+    template<class Network>
+    class NetworkAssignAnalyzer : public NetworkAnalyzer<Network>
+    {
+    public:
+        explicit NetworkAssignAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Network& structure) override;
+
+    private:
+        Network copy_;
+    };
+
+    /**
+     * @brief Analyzes complexity of comparing a network with its copy.
+     */
+    template<class Network>
+    class NetworkEqualsAnalyzer : public NetworkAnalyzer<Network>
+    {
+    public:
+        explicit NetworkEqualsAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Network& structure) override;
+
+    private:
+        Network copy_;
+    };
+
+    /**
+     * @brief Analyzes complexity of removing every other node of a copy of the network at once.
+     */
+    template<class Network>
+    class NetworkRemoveAnalyzer : public NetworkAnalyzer<Network>
+    {
+    public:
+        explicit NetworkRemoveAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Network& structure) override;
+
+    private:
+        Network copy_;
+    };
+
+    /**
+     * @brief Analyzes complexity of a breadth-first search, including freezing of the network.
+     */
+    template<class Network>
+    class NetworkBreadthFirstSearchAnalyzer : public NetworkAnalyzer<Network>
+    {
+    public:
+        explicit NetworkBreadthFirstSearchAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Network& structure) override;
+    };
+
+    /**
+     * @brief Analyzes complexity of an algorithm over a frozen snapshot of the network.
+     *
+     * The snapshot is created before the measured operation.
+     */
+    template<class Network>
+    class FrozenNetworkAlgorithmAnalyzer : public NetworkAnalyzer<Network>
+    {
+    public:
+        using FrozenNetworkType = amt::FrozenNetwork<typename Network::NodeType>;
+
+        FrozenNetworkAlgorithmAnalyzer(const std::string& name, std::function<void(const FrozenNetworkType&)> algorithm);
+
+    protected:
+        void executeOperation(Network& structure) override;
+
+    private:
+        std::function<void(const FrozenNetworkType&)> algorithm_;
+        std::unique_ptr<FrozenNetworkType> frozen_;
+    };
+
+    /**
+     * @brief Container for all network analyzers.
+     */
+    class NetworksAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        NetworksAnalyzer();
+    };
+
+    //----------
+
+    template<class Network>
+    NetworkAnalyzer<Network>::NetworkAnalyzer(const std::string& name) :
+        ComplexityAnalyzer<Network>(name),
+        rngData_(144),
+        rngNode_(144)
+    {
+    }
+
+    template<class Network>
+    void NetworkAnalyzer<Network>::growToSize(Network& structure, size_t size)
+    {
+        if (structure.isEmpty())
+        {
+            nodes_.clear();
+        }
+
+        while (nodes_.size() < size)
+        {
+            NodeType& node = structure.insert();
+            node.data_ = static_cast<int>(rngData_());
+            if (!nodes_.empty())
+            {
+                std::uniform_int_distribution<size_t> nodeDist(0, nodes_.size() - 1);
+                for (size_t i = 0; i < RELATIONS_PER_NODE; ++i)
+                {
+                    structure.connect(node, *nodes_[nodeDist(rngNode_)]);
+                }
+            }
+            nodes_.push_back(&node);
+        }
+    }
+
+    //----------
+
+    template<class Network>
+    NetworkAssignAnalyzer<Network>::NetworkAssignAnalyzer(const std::string& name) :
+        NetworkAnalyzer<Network>(name)
+    {
+        this->registerAfterOperation([this](Network&)
+            {
+                copy_.clear();
+            });
+    }
+
+    template<class Network>
+    void NetworkAssignAnalyzer<Network>::executeOperation(Network& structure)
+    {
+        copy_.assign(structure);
+    }
+
+    //----------
+
+    template<class Network>
+    NetworkEqualsAnalyzer<Network>::NetworkEqualsAnalyzer(const std::string& name) :
+        NetworkAnalyzer<Network>(name)
+    {
+        this->registerBeforeOperation([this](Network& structure)
+            {
+                copy_.assign(structure);
+            });
+        this->registerAfterOperation([this](Network&)
+            {
+                copy_.clear();
+            });
+    }
+
+    template<class Network>
+    void NetworkEqualsAnalyzer<Network>::executeOperation(Network& structure)
+    {
+        if (!structure.equals(copy_))
+        {
+            throw std::logic_error("Network differs from its copy!");
+        }
+    }
+
+    //----------
+
+    template<class Network>
+    NetworkRemoveAnalyzer<Network>::NetworkRemoveAnalyzer(const std::string& name) :
+        NetworkAnalyzer<Network>(name)
+    {
+        this->registerBeforeOperation([this](Network& structure)
+            {
+                copy_.assign(structure);
+            });
+        this->registerAfterOperation([this](Network&)
+            {
+                copy_.clear();
+            });
+    }
+
+    template<class Network>
+    void NetworkRemoveAnalyzer<Network>::executeOperation(Network&)
+    {
+        bool remove = false;
+        copy_.removeWithProperty([&remove](typename Network::NodeType*)
+            {
+                remove = !remove;
+                return remove;
+            });
+    }
+
+    template<class Network>
+    NetworkBreadthFirstSearchAnalyzer<Network>::NetworkBreadthFirstSearchAnalyzer(const std::string& name) :
+        NetworkAnalyzer<Network>(name)
+    {
+    }
+
+    template<class Network>
+    void NetworkBreadthFirstSearchAnalyzer<Network>::executeOperation(Network& structure)
+    {
+        adt::breadthFirstSearch(structure, **structure.begin());
+    }
+
+    //----------
+
+    template<class Network>
+    FrozenNetworkAlgorithmAnalyzer<Network>::FrozenNetworkAlgorithmAnalyzer(const std::string& name, std::function<void(const FrozenNetworkType&)> algorithm) :
+        NetworkAnalyzer<Network>(name),
+        algorithm_(std::move(algorithm))
+    {
+        this->registerBeforeOperation([this](Network& structure)
+            {
+                frozen_ = std::make_unique<FrozenNetworkType>(structure);
+            });
+        this->registerAfterOperation([this](Network&)
+            {
+                frozen_.reset();
+            });
+    }
+
+    template<class Network>
+    void FrozenNetworkAlgorithmAnalyzer<Network>::executeOperation(Network&)
+    {
+        algorithm_(*frozen_);
+    }
+
+    //----------
+
+    inline NetworksAnalyzer::NetworksAnalyzer() :
+        CompositeAnalyzer("Networks")
+    {
+        this->addAnalyzer(std::make_unique<NetworkAssignAnalyzer<amt::IGIRNetwork<int>>>("igir-network-assign"));
+        this->addAnalyzer(std::make_unique<NetworkAssignAnalyzer<amt::EGERNetwork<int>>>("eger-network-assign"));
+        this->addAnalyzer(std::make_unique<NetworkEqualsAnalyzer<amt::IGIRNetwork<int>>>("igir-network-equals"));
+        this->addAnalyzer(std::make_unique<NetworkEqualsAnalyzer<amt::EGERNetwork<int>>>("eger-network-equals"));
+        this->addAnalyzer(std::make_unique<NetworkRemoveAnalyzer<amt::IGIRNetwork<int>>>("igir-network-remove"));
+        this->addAnalyzer(std::make_unique<NetworkRemoveAnalyzer<amt::EGERNetwork<int>>>("eger-network-remove"));
+
+        using FrozenEGER = amt::FrozenNetwork<amt::ERNetworkBlock<int>>;
+        this->addAnalyzer(std::make_unique<NetworkBreadthFirstSearchAnalyzer<amt::EGERNetwork<int>>>("eger-bfs"));
+        this->addAnalyzer(std::make_unique<FrozenNetworkAlgorithmAnalyzer<amt::EGERNetwork<int>>>("frozen-bfs", [](const FrozenEGER& network)
+            {
+                adt::breadthFirstSearch(network, 0);
+            }));
+        this->addAnalyzer(std::make_unique<FrozenNetworkAlgorithmAnalyzer<amt::EGERNetwork<int>>>("frozen-parallel-bfs", [](const FrozenEGER& network)
+            {
+                adt::parallelBreadthFirstSearch(network, 0);
+            }));
+        this->addAnalyzer(std::make_unique<FrozenNetworkAlgorithmAnalyzer<amt::EGERNetwork<int>>>("frozen-components", [](const FrozenEGER& network)
+            {
+                adt::connectedComponents(network);
+            }));
+        this->addAnalyzer(std::make_unique<FrozenNetworkAlgorithmAnalyzer<amt::EGERNetwork<int>>>("frozen-dijkstra", [](const FrozenEGER& network)
+            {
+                adt::dijkstra<long long, amt::ERNetworkBlock<int>>(network, 0, [](const auto& a, const auto& b)
+                    {
+                        return static_cast<long long>(a.data_ % 100 + b.data_ % 100 + 200);
+                    });
+            }));
+    }
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/concurrent_queue.h>
+#include <libds/adt/queue.h>
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ds::utils
+{
+    namespace details
+    {
+        /**
+         * @brief Explicit queue guarded by a mutex, the baseline for concurrent queues.
+         */
+        template<typename T>
+        class LockedQueue
+        {
+        public:
+            LockedQueue() = default;
+            LockedQueue(const LockedQueue& other) : queue_(other.queue_) {}
+
+            void push(T element)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queue_.push(element);
+            }
+
+            bool tryPop(T& element)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (queue_.isEmpty())
+                {
+                    return false;
+                }
+                element = queue_.pop();
+                return true;
+            }
+
+            size_t size() const
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                return queue_.size();
+            }
+
+            void clear()
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                queue_.clear();
+            }
+
+        private:
+            adt::ExplicitQueue<T> queue_;
+            mutable std::mutex mutex_;
+        };
+    }
+
+    /**
+     * @brief Analyzes throughput of a queue under contention.
+     *
+     * The operation starts the given number of threads, each of which pushes
+     * and pops OPERATIONS_PER_THREAD elements in turns.
+     */
+    template<class Queue>
+    class ConcurrentQueueAnalyzer : public ComplexityAnalyzer<Queue>
+    {
+    public:
+        ConcurrentQueueAnalyzer(const std::string& name, size_t threadCount);
+
+    protected:
+        void growToSize(Queue& structure, size_t size) override;
+        void executeOperation(Queue& structure) override;
+
+    private:
+        static const int OPERATIONS_PER_THREAD = 10'000;
+
+        size_t threadCount_;
+    };
+
+    /**
+     * @brief Analyzer of a bounded queue with room for all analyzed sizes.
+     */
+    template<class Queue>
+    class BoundedConcurrentQueueAnalyzer : public ConcurrentQueueAnalyzer<Queue>
+    {
+    public:
+        BoundedConcurrentQueueAnalyzer(const std::string& name, size_t threadCount);
+
+    protected:
+        Queue createPrototype() override;
+
+    private:
+        static const size_t CAPACITY = 1 << 20;
+    };
+
+    /**
+     * @brief Container for all queue analyzers.
+     */
+    class QueuesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        QueuesAnalyzer();
+    };
+
+    //----------
+
+    template<class Queue>
+    ConcurrentQueueAnalyzer<Queue>::ConcurrentQueueAnalyzer(const std::string& name, size_t threadCount) :
+        ComplexityAnalyzer<Queue>(name),
+        threadCount_(threadCount)
+    {
+    }
+
+    template<class Queue>
+    void ConcurrentQueueAnalyzer<Queue>::growToSize(Queue& structure, size_t size)
+    {
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            structure.push(static_cast<int>(i));
+        }
+    }
+
+    template<class Queue>
+    void ConcurrentQueueAnalyzer<Queue>::executeOperation(Queue& structure)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(threadCount_);
+        for (size_t t = 0; t < threadCount_; ++t)
+        {
+            threads.emplace_back([&structure]()
+                {
+                    int element = 0;
+                    for (int i = 0; i < OPERATIONS_PER_THREAD; ++i)
+                    {
+                        structure.push(i);
+                        structure.tryPop(element);
+                    }
+                });
+        }
+        for (std::thread& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    //----------
+
+    template<class Queue>
+    BoundedConcurrentQueueAnalyzer<Queue>::BoundedConcurrentQueueAnalyzer(const std::string& name, size_t threadCount) :
+        ConcurrentQueueAnalyzer<Queue>(name, threadCount)
+    {
+    }
+
+    template<class Queue>
+    Queue BoundedConcurrentQueueAnalyzer<Queue>::createPrototype()
+    {
+        return Queue(CAPACITY);
+    }
+
+    //----------
+
+    inline QueuesAnalyzer::QueuesAnalyzer() :
+        CompositeAnalyzer("Queues")
+    {
+        const size_t maxThreadCount = std::max<size_t>(2, std::thread::hardware_concurrency());
+        for (size_t threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+        {
+            const std::string suffix = "-" + std::to_string(threadCount) + "-threads";
+            this->addAnalyzer(std::make_unique<ConcurrentQueueAnalyzer<details::LockedQueue<int>>>("locked-queue" + suffix, threadCount));
+            this->addAnalyzer(std::make_unique<ConcurrentQueueAnalyzer<adt::ConcurrentQueue<int>>>("mpmc-queue" + suffix, threadCount));
+            this->addAnalyzer(std::make_unique<BoundedConcurrentQueueAnalyzer<adt::BoundedConcurrentQueue<int>>>("bounded-mpmc-queue" + suffix, threadCount));
+        }
+    }
+}
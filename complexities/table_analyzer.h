@@ -0,0 +1,396 @@
+#pragma once
+
+#include <complexities/complexity_analyzer.h>
+#include <libds/adt/flat_hash_table.h>
+#include <libds/adt/robin_hood_hash_table.h>
+#include <libds/adt/table.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ds::utils
+{
+    /**
+     * @brief Order in which a table analyzer inserts the keys of its table.
+     */
+    enum class InsertOrder
+    {
+        /** Ascending keys, the worst case of an unbalanced search tree. */
+        Sorted,
+        /** Pseudo-random keys. */
+        Random,
+        /** Keys extending the smallest and the largest key in turns, adversarial to unbalanced trees as well. */
+        Alternating
+    };
+
+    /**
+     * @brief Common base for table analyzers.
+     *
+     * A table of size n holds n distinct even keys, by default 0, 2, ..., 2(n - 1), inserted in the given
+     * order. Before each operation a random present (even) and a random missing (odd) key are chosen.
+     * Operations which change the table are undone after the measurement, so its size stays n.
+     */
+    template<class Table>
+    class TableAnalyzer : public ComplexityAnalyzer<Table>
+    {
+    protected:
+        explicit TableAnalyzer(const std::string& name, InsertOrder order = InsertOrder::Sorted);
+
+    protected:
+        void growToSize(Table& structure, size_t size) override;
+
+        /**
+         * @brief Key inserted as the @p index-th one.
+         */
+        int getKeyAt(size_t index) const;
+        int getPresentKey() const;
+        int getMissingKey() const;
+
+    private:
+        InsertOrder order_;
+        std::default_random_engine rngKey_;
+        int presentKey_;
+        int missingKey_;
+    };
+
+    /**
+     * @brief Analyzes an insertion of a missing key.
+     */
+    template<class Table>
+    class TableInsertAnalyzer : public TableAnalyzer<Table>
+    {
+    public:
+        explicit TableInsertAnalyzer(const std::string& name, InsertOrder order = InsertOrder::Sorted);
+
+    protected:
+        void executeOperation(Table& structure) override;
+    };
+
+    /**
+     * @brief Analyzes a successful lookup.
+     */
+    template<class Table>
+    class TableFindHitAnalyzer : public TableAnalyzer<Table>
+    {
+    public:
+        explicit TableFindHitAnalyzer(const std::string& name, InsertOrder order = InsertOrder::Sorted);
+
+    protected:
+        void executeOperation(Table& structure) override;
+    };
+
+    /**
+     * @brief Analyzes an unsuccessful lookup.
+     */
+    template<class Table>
+    class TableFindMissAnalyzer : public TableAnalyzer<Table>
+    {
+    public:
+        explicit TableFindMissAnalyzer(const std::string& name, InsertOrder order = InsertOrder::Sorted);
+
+    protected:
+        void executeOperation(Table& structure) override;
+    };
+
+    /**
+     * @brief Analyzes a removal of a present key.
+     */
+    template<class Table>
+    class TableRemoveAnalyzer : public TableAnalyzer<Table>
+    {
+    public:
+        explicit TableRemoveAnalyzer(const std::string& name, InsertOrder order = InsertOrder::Sorted);
+
+    protected:
+        void executeOperation(Table& structure) override;
+    };
+
+    /**
+     * @brief Common base for analyzers of LOOKUP_COUNT lookups of random present keys,
+     * which are chosen before each operation.
+     */
+    template<class Table>
+    class TableLookupsAnalyzer : public TableAnalyzer<Table>
+    {
+    public:
+        static constexpr size_t LOOKUP_COUNT = 256;
+
+    protected:
+        explicit TableLookupsAnalyzer(const std::string& name);
+
+        const std::vector<int>& getKeys() const;
+        int** getData();
+
+    private:
+        std::default_random_engine rngKeys_;
+        std::vector<int> keys_;
+        std::vector<int*> data_;
+    };
+
+    /**
+     * @brief Analyzes LOOKUP_COUNT successful lookups done by tryFind one after another.
+     */
+    template<class Table>
+    class TableFindLoopAnalyzer : public TableLookupsAnalyzer<Table>
+    {
+    public:
+        explicit TableFindLoopAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Table& structure) override;
+    };
+
+    /**
+     * @brief Analyzes LOOKUP_COUNT successful lookups done by a single tryFindBatch.
+     */
+    template<class Table>
+    class TableFindBatchAnalyzer : public TableLookupsAnalyzer<Table>
+    {
+    public:
+        explicit TableFindBatchAnalyzer(const std::string& name);
+
+    protected:
+        void executeOperation(Table& structure) override;
+    };
+
+    /**
+     * @brief Container for all table analyzers.
+     */
+    class TablesAnalyzer : public CompositeAnalyzer
+    {
+    public:
+        TablesAnalyzer();
+
+    private:
+        template<class Table>
+        void addTableAnalyzers(const std::string& tableName);
+
+        /**
+         * @brief Adds the analyzers of single operations of a table built by inserting its keys in @p order.
+         */
+        template<class Table>
+        void addInsertOrderAnalyzers(const std::string& tableName, InsertOrder order, const std::string& orderName);
+    };
+
+    //----------
+
+    template<class Table>
+    TableAnalyzer<Table>::TableAnalyzer(const std::string& name, InsertOrder order) :
+        ComplexityAnalyzer<Table>(name),
+        order_(order),
+        rngKey_(144),
+        presentKey_(0),
+        missingKey_(1)
+    {
+        ComplexityAnalyzer<Table>::registerBeforeOperation([this](Table& table)
+            {
+                std::uniform_int_distribution<size_t> indexDist(0, table.size() - 1);
+                presentKey_ = this->getKeyAt(indexDist(rngKey_));
+                missingKey_ = this->getKeyAt(indexDist(rngKey_)) + 1;
+            });
+    }
+
+    template<class Table>
+    void TableAnalyzer<Table>::growToSize(Table& structure, size_t size)
+    {
+        for (size_t i = structure.size(); i < size; ++i)
+        {
+            structure.insert(this->getKeyAt(i), static_cast<int>(i));
+        }
+    }
+
+    template<class Table>
+    int TableAnalyzer<Table>::getKeyAt(size_t index) const
+    {
+        const int key = 2 * static_cast<int>(index);
+        switch (order_)
+        {
+        case InsertOrder::Random:
+            // Multiplication by an odd constant permutes the 30-bit numbers.
+            return 2 * static_cast<int>((static_cast<std::uint32_t>(index) * 2654435761u) & 0x3FFF'FFFFu);
+        case InsertOrder::Alternating:
+            return index % 2 == 0 ? key : -key;
+        default:
+            return key;
+        }
+    }
+
+    template<class Table>
+    int TableAnalyzer<Table>::getPresentKey() const
+    {
+        return presentKey_;
+    }
+
+    template<class Table>
+    int TableAnalyzer<Table>::getMissingKey() const
+    {
+        return missingKey_;
+    }
+
+    //----------
+
+    template<class Table>
+    TableInsertAnalyzer<Table>::TableInsertAnalyzer(const std::string& name, InsertOrder order) :
+        TableAnalyzer<Table>(name, order)
+    {
+        ComplexityAnalyzer<Table>::registerAfterOperation([this](Table& table)
+            {
+                table.remove(this->getMissingKey());
+            });
+    }
+
+    template<class Table>
+    void TableInsertAnalyzer<Table>::executeOperation(Table& structure)
+    {
+        structure.insert(this->getMissingKey(), 0);
+    }
+
+    //----------
+
+    template<class Table>
+    TableFindHitAnalyzer<Table>::TableFindHitAnalyzer(const std::string& name, InsertOrder order) :
+        TableAnalyzer<Table>(name, order)
+    {
+    }
+
+    template<class Table>
+    void TableFindHitAnalyzer<Table>::executeOperation(Table& structure)
+    {
+        int* data = nullptr;
+        structure.tryFind(this->getPresentKey(), data);
+    }
+
+    //----------
+
+    template<class Table>
+    TableFindMissAnalyzer<Table>::TableFindMissAnalyzer(const std::string& name, InsertOrder order) :
+        TableAnalyzer<Table>(name, order)
+    {
+    }
+
+    template<class Table>
+    void TableFindMissAnalyzer<Table>::executeOperation(Table& structure)
+    {
+        int* data = nullptr;
+        structure.tryFind(this->getMissingKey(), data);
+    }
+
+    //----------
+
+    template<class Table>
+    TableRemoveAnalyzer<Table>::TableRemoveAnalyzer(const std::string& name, InsertOrder order) :
+        TableAnalyzer<Table>(name, order)
+    {
+        ComplexityAnalyzer<Table>::registerAfterOperation([this](Table& table)
+            {
+                table.insert(this->getPresentKey(), this->getPresentKey() / 2);
+            });
+    }
+
+    template<class Table>
+    void TableRemoveAnalyzer<Table>::executeOperation(Table& structure)
+    {
+        structure.remove(this->getPresentKey());
+    }
+
+    //----------
+
+    template<class Table>
+    TableLookupsAnalyzer<Table>::TableLookupsAnalyzer(const std::string& name) :
+        TableAnalyzer<Table>(name),
+        rngKeys_(377),
+        keys_(LOOKUP_COUNT),
+        data_(LOOKUP_COUNT)
+    {
+        ComplexityAnalyzer<Table>::registerBeforeOperation([this](Table& table)
+            {
+                std::uniform_int_distribution<int> keyDist(0, static_cast<int>(table.size()) - 1);
+                for (int& key : keys_)
+                {
+                    key = 2 * keyDist(rngKeys_);
+                }
+            });
+    }
+
+    template<class Table>
+    const std::vector<int>& TableLookupsAnalyzer<Table>::getKeys() const
+    {
+        return keys_;
+    }
+
+    template<class Table>
+    int** TableLookupsAnalyzer<Table>::getData()
+    {
+        return data_.data();
+    }
+
+    //----------
+
+    template<class Table>
+    TableFindLoopAnalyzer<Table>::TableFindLoopAnalyzer(const std::string& name) :
+        TableLookupsAnalyzer<Table>(name)
+    {
+    }
+
+    template<class Table>
+    void TableFindLoopAnalyzer<Table>::executeOperation(Table& structure)
+    {
+        int** data = this->getData();
+        for (size_t i = 0; i < this->LOOKUP_COUNT; ++i)
+        {
+            structure.tryFind(this->getKeys()[i], data[i]);
+        }
+    }
+
+    //----------
+
+    template<class Table>
+    TableFindBatchAnalyzer<Table>::TableFindBatchAnalyzer(const std::string& name) :
+        TableLookupsAnalyzer<Table>(name)
+    {
+    }
+
+    template<class Table>
+    void TableFindBatchAnalyzer<Table>::executeOperation(Table& structure)
+    {
+        structure.tryFindBatch(this->getKeys().data(), this->LOOKUP_COUNT, this->getData());
+    }
+
+    //----------
+
+    inline TablesAnalyzer::TablesAnalyzer() :
+        CompositeAnalyzer("Tables")
+    {
+        this->addTableAnalyzers<adt::HashTable<int, int>>("hash-table");
+        this->addTableAnalyzers<adt::FlatHashTable<int, int>>("flat-hash-table");
+        this->addTableAnalyzers<adt::RobinHoodHashTable<int, int>>("robin-hood-hash-table");
+        this->addInsertOrderAnalyzers<adt::AVLTree<int, int>>("avl-tree", InsertOrder::Sorted, "sorted");
+        this->addInsertOrderAnalyzers<adt::AVLTree<int, int>>("avl-tree", InsertOrder::Random, "random");
+        this->addInsertOrderAnalyzers<adt::AVLTree<int, int>>("avl-tree", InsertOrder::Alternating, "alternating");
+        // Sorted and alternating keys build a path, i.e. O(n^2) per replication.
+        this->addInsertOrderAnalyzers<adt::BinarySearchTree<int, int>>("binary-search-tree", InsertOrder::Random, "random");
+    }
+
+    template<class Table>
+    void TablesAnalyzer::addTableAnalyzers(const std::string& tableName)
+    {
+        this->addAnalyzer(std::make_unique<TableInsertAnalyzer<Table>>(tableName + "-insert"));
+        this->addAnalyzer(std::make_unique<TableFindHitAnalyzer<Table>>(tableName + "-find-hit"));
+        this->addAnalyzer(std::make_unique<TableFindMissAnalyzer<Table>>(tableName + "-find-miss"));
+        this->addAnalyzer(std::make_unique<TableRemoveAnalyzer<Table>>(tableName + "-remove"));
+        this->addAnalyzer(std::make_unique<TableFindLoopAnalyzer<Table>>(tableName + "-find-loop"));
+        this->addAnalyzer(std::make_unique<TableFindBatchAnalyzer<Table>>(tableName + "-find-batch"));
+    }
+
+    template<class Table>
+    void TablesAnalyzer::addInsertOrderAnalyzers(const std::string& tableName, InsertOrder order, const std::string& orderName)
+    {
+        const std::string prefix = tableName + "-" + orderName;
+        this->addAnalyzer(std::make_unique<TableInsertAnalyzer<Table>>(prefix + "-insert", order));
+        this->addAnalyzer(std::make_unique<TableFindHitAnalyzer<Table>>(prefix + "-find-hit", order));
+        this->addAnalyzer(std::make_unique<TableFindMissAnalyzer<Table>>(prefix + "-find-miss", order));
+        this->addAnalyzer(std::make_unique<TableRemoveAnalyzer<Table>>(prefix + "-remove", order));
+    }
+}
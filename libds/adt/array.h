@@ -42,6 +42,11 @@ namespace ds::adt {
         size_t size() const override;
         long long getBase() const;
 
+        /**
+         * @brief Enables or disables copy-on-write, see amt::ImplicitAMS::setCopyOnWrite.
+         */
+        void setCopyOnWrite(bool copyOnWrite);
+
         T access(long long index) const;
         void set(T element, long long index);
 
@@ -196,6 +201,12 @@ namespace ds::adt {
         return base_;
     }
 
+    template<typename T>
+    void Array<T>::setCopyOnWrite(bool copyOnWrite)
+    {
+        this->getSequence()->setCopyOnWrite(copyOnWrite);
+    }
+
     template<typename T>
     T Array<T>::access(long long index) const
     {
@@ -203,7 +214,7 @@ namespace ds::adt {
         {
             throw std::out_of_range("Invalid index!");
         }
-        return this->getSequence()->access(this->mapIndex(index))->data_;
+        return this->getSequence()->peek(this->mapIndex(index))->data_;
     }
 
     template<typename T>
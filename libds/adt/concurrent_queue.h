@@ -0,0 +1,816 @@
+#pragma once
+
+#include <libds/adt/queue.h>
+#include <libds/constants.h>
+#include <libds/mm/hazard_pointers.h>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::adt {
+
+    /**
+     * @brief Unbounded lock-free multi-producer multi-consumer queue (Michael and Scott).
+     *
+     * push, tryPop, pop, clear and size may be called from any number of threads at once;
+     * size is only a snapshot then. Popped nodes are reclaimed with mm::HazardPointers.
+     * peek is unavailable, since the peeked element could be popped by another thread.
+     * assign and equals read the other queue without synchronization, so no other thread
+     * may use it meanwhile.
+     */
+    template<typename T>
+    class ConcurrentQueue :
+        public Queue<T>
+    {
+    public:
+        ConcurrentQueue();
+        ConcurrentQueue(const ConcurrentQueue& other);
+        ~ConcurrentQueue() override;
+
+        ADT& assign(const ADT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+        bool equals(const ADT& other) override;
+
+        void push(T element) override;
+        T& peek() override; // throw(unavailable_function_call)
+        T pop() override;
+
+        /**
+         * @brief Moves the first element to @p element.
+         * @return false if the queue was empty, @p element is unchanged then.
+         */
+        bool tryPop(T& element);
+
+    private:
+        struct Node
+        {
+            std::optional<T> data_;
+            std::atomic<Node*> next_{ nullptr };
+        };
+
+    private:
+        alignas(CACHE_LINE_SIZE) std::atomic<Node*> head_;
+        alignas(CACHE_LINE_SIZE) std::atomic<Node*> tail_;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::ptrdiff_t> size_;
+    };
+
+    //----------
+
+    /**
+     * @brief Bounded lock-free multi-producer multi-consumer queue over a ring of cells (Vyukov).
+     *
+     * Each cell carries a sequence number telling producers and consumers whose turn it is,
+     * so a push or pop costs one compare-and-swap of a shared position. The capacity is
+     * rounded up to a power of two. Thread safety is the same as of ConcurrentQueue.
+     */
+    template<typename T>
+    class BoundedConcurrentQueue :
+        public Queue<T>
+    {
+    public:
+        BoundedConcurrentQueue();
+        explicit BoundedConcurrentQueue(size_t capacity);
+        BoundedConcurrentQueue(const BoundedConcurrentQueue& other);
+
+        size_t getCapacity() const;
+
+        ADT& assign(const ADT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+        bool equals(const ADT& other) override;
+
+        void push(T element) override; // throw(structure_error) if the queue is full
+        T& peek() override; // throw(unavailable_function_call)
+        T pop() override;
+
+        /**
+         * @brief Pushes @p element unless the queue is full.
+         * @return false if the queue was full.
+         */
+        bool tryPush(T element);
+
+        /**
+         * @brief Moves the first element to @p element.
+         * @return false if the queue was empty, @p element is unchanged then.
+         */
+        bool tryPop(T& element);
+
+        static const size_t INIT_CAPACITY = 1024;
+
+    private:
+        struct Cell
+        {
+            std::atomic<size_t> sequence_;
+            T data_;
+        };
+
+        void allocateCells(size_t capacity);
+
+    private:
+        std::unique_ptr<Cell[]> cells_;
+        size_t mask_;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePosition_;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePosition_;
+    };
+
+    //----------
+
+    /**
+     * @brief Wait-free single-producer single-consumer queue over a ring buffer.
+     *
+     * One thread may push (push, tryPush, pushN) while another pops (peek, pop, tryPop,
+     * popN, clear). The positions grow freely and are masked by the power-of-two capacity,
+     * and each side keeps a cached copy of the other side's position, so the shared cache
+     * lines are read only when the ring looks full or empty. pushN and popN publish a whole
+     * batch with a single release store. assign and equals expect no concurrent access.
+     */
+    template<typename T>
+    class SpscQueue :
+        public Queue<T>
+    {
+    public:
+        SpscQueue();
+        explicit SpscQueue(size_t capacity);
+        SpscQueue(const SpscQueue& other);
+
+        size_t getCapacity() const;
+
+        ADT& assign(const ADT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+        bool equals(const ADT& other) override;
+
+        void push(T element) override; // throw(structure_error) if the queue is full
+        T& peek() override;
+        T pop() override;
+
+        /**
+         * @brief Pushes @p element unless the queue is full.
+         * @return false if the queue was full.
+         */
+        bool tryPush(T element);
+
+        /**
+         * @brief Moves the first element to @p element.
+         * @return false if the queue was empty, @p element is unchanged then.
+         */
+        bool tryPop(T& element);
+
+        /**
+         * @brief Pushes as many of the @p count elements starting at @p elements as fit.
+         * @return Number of pushed elements.
+         */
+        size_t pushN(const T* elements, size_t count);
+
+        /**
+         * @brief Moves up to @p count first elements to the array starting at @p elements.
+         * @return Number of popped elements.
+         */
+        size_t popN(T* elements, size_t count);
+
+        static const size_t INIT_CAPACITY = 1024;
+
+    private:
+        void allocateBuffer(size_t capacity);
+
+    private:
+        std::unique_ptr<T[]> buffer_;
+        size_t mask_;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> head_;
+        size_t cachedTail_;
+        alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail_;
+        size_t cachedHead_;
+    };
+
+    //----------
+
+    template<typename T>
+    ConcurrentQueue<T>::ConcurrentQueue() :
+        head_(new Node()),
+        tail_(head_.load()),
+        size_(0)
+    {
+    }
+
+    template<typename T>
+    ConcurrentQueue<T>::ConcurrentQueue(const ConcurrentQueue& other) :
+        ConcurrentQueue()
+    {
+        this->assign(other);
+    }
+
+    template<typename T>
+    ConcurrentQueue<T>::~ConcurrentQueue()
+    {
+        Node* node = head_.load();
+        while (node != nullptr)
+        {
+            Node* next = node->next_.load();
+            delete node;
+            node = next;
+        }
+        head_ = nullptr;
+        tail_ = nullptr;
+    }
+
+    template<typename T>
+    ADT& ConcurrentQueue<T>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            const ConcurrentQueue<T>& otherQueue = dynamic_cast<const ConcurrentQueue<T>&>(other);
+            this->clear();
+            for (Node* node = otherQueue.head_.load()->next_.load(); node != nullptr; node = node->next_.load())
+            {
+                this->push(*node->data_);
+            }
+        }
+        return *this;
+    }
+
+    template<typename T>
+    void ConcurrentQueue<T>::clear()
+    {
+        T element;
+        while (this->tryPop(element))
+        {
+        }
+    }
+
+    template<typename T>
+    size_t ConcurrentQueue<T>::size() const
+    {
+        const std::ptrdiff_t size = size_.load(std::memory_order_relaxed);
+        return size > 0 ? static_cast<size_t>(size) : 0;
+    }
+
+    template<typename T>
+    bool ConcurrentQueue<T>::isEmpty() const
+    {
+        return this->size() == 0;
+    }
+
+    template<typename T>
+    bool ConcurrentQueue<T>::equals(const ADT& other)
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const ConcurrentQueue<T>* otherQueue = dynamic_cast<const ConcurrentQueue<T>*>(&other);
+        if (otherQueue == nullptr)
+        {
+            return false;
+        }
+
+        Node* myNode = head_.load()->next_.load();
+        Node* otherNode = otherQueue->head_.load()->next_.load();
+        while (myNode != nullptr && otherNode != nullptr)
+        {
+            if (!(*myNode->data_ == *otherNode->data_))
+            {
+                return false;
+            }
+            myNode = myNode->next_.load();
+            otherNode = otherNode->next_.load();
+        }
+        return myNode == otherNode;
+    }
+
+    template<typename T>
+    void ConcurrentQueue<T>::push(T element)
+    {
+        Node* node = new Node();
+        node->data_.emplace(std::move(element));
+
+        while (true)
+        {
+            Node* tail = mm::HazardPointers::protect(0, tail_);
+            Node* next = tail->next_.load(std::memory_order_acquire);
+            if (tail != tail_.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+
+            if (next != nullptr)
+            {
+                // Tail lags behind, help the pending push to finish.
+                tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            if (tail->next_.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed))
+            {
+                tail_.compare_exchange_strong(tail, node, std::memory_order_release, std::memory_order_relaxed);
+                break;
+            }
+        }
+
+        mm::HazardPointers::clear(0);
+        size_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    T& ConcurrentQueue<T>::peek()
+    {
+        throw amt::unavailable_function_call("Concurrent queue can't be peeked, use tryPop!");
+    }
+
+    template<typename T>
+    T ConcurrentQueue<T>::pop()
+    {
+        T result;
+        if (!this->tryPop(result))
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+        return result;
+    }
+
+    template<typename T>
+    bool ConcurrentQueue<T>::tryPop(T& element)
+    {
+        while (true)
+        {
+            Node* head = mm::HazardPointers::protect(0, head_);
+            Node* next = mm::HazardPointers::protect(1, head->next_);
+            if (head != head_.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+
+            if (next == nullptr)
+            {
+                mm::HazardPointers::clearAll();
+                return false;
+            }
+
+            Node* tail = tail_.load(std::memory_order_acquire);
+            if (head == tail)
+            {
+                tail_.compare_exchange_weak(tail, next, std::memory_order_release, std::memory_order_relaxed);
+                continue;
+            }
+
+            if (head_.compare_exchange_weak(head, next, std::memory_order_acq_rel, std::memory_order_relaxed))
+            {
+                // Next becomes the new dummy, only this thread touches its data.
+                element = std::move(*next->data_);
+                next->data_.reset();
+                mm::HazardPointers::clearAll();
+                mm::HazardPointers::retire(head);
+                size_.fetch_sub(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+
+    //----------
+
+    template<typename T>
+    BoundedConcurrentQueue<T>::BoundedConcurrentQueue() :
+        BoundedConcurrentQueue(INIT_CAPACITY)
+    {
+    }
+
+    template<typename T>
+    BoundedConcurrentQueue<T>::BoundedConcurrentQueue(size_t capacity) :
+        mask_(0),
+        enqueuePosition_(0),
+        dequeuePosition_(0)
+    {
+        this->allocateCells(capacity);
+    }
+
+    template<typename T>
+    BoundedConcurrentQueue<T>::BoundedConcurrentQueue(const BoundedConcurrentQueue& other) :
+        BoundedConcurrentQueue(other.getCapacity())
+    {
+        this->assign(other);
+    }
+
+    template<typename T>
+    size_t BoundedConcurrentQueue<T>::getCapacity() const
+    {
+        return mask_ + 1;
+    }
+
+    template<typename T>
+    ADT& BoundedConcurrentQueue<T>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            const BoundedConcurrentQueue<T>& otherQueue = dynamic_cast<const BoundedConcurrentQueue<T>&>(other);
+            if (this->getCapacity() != otherQueue.getCapacity())
+            {
+                this->allocateCells(otherQueue.getCapacity());
+            }
+            else
+            {
+                this->clear();
+            }
+
+            const size_t end = otherQueue.enqueuePosition_.load();
+            for (size_t position = otherQueue.dequeuePosition_.load(); position != end; ++position)
+            {
+                this->push(otherQueue.cells_[position & otherQueue.mask_].data_);
+            }
+        }
+        return *this;
+    }
+
+    template<typename T>
+    void BoundedConcurrentQueue<T>::clear()
+    {
+        T element;
+        while (this->tryPop(element))
+        {
+        }
+    }
+
+    template<typename T>
+    size_t BoundedConcurrentQueue<T>::size() const
+    {
+        const size_t dequeuePosition = dequeuePosition_.load(std::memory_order_relaxed);
+        const size_t enqueuePosition = enqueuePosition_.load(std::memory_order_relaxed);
+        return enqueuePosition > dequeuePosition ? enqueuePosition - dequeuePosition : 0;
+    }
+
+    template<typename T>
+    bool BoundedConcurrentQueue<T>::isEmpty() const
+    {
+        return this->size() == 0;
+    }
+
+    template<typename T>
+    bool BoundedConcurrentQueue<T>::equals(const ADT& other)
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const BoundedConcurrentQueue<T>* otherQueue = dynamic_cast<const BoundedConcurrentQueue<T>*>(&other);
+        if (otherQueue == nullptr || this->size() != otherQueue->size())
+        {
+            return false;
+        }
+
+        size_t myPosition = dequeuePosition_.load();
+        size_t otherPosition = otherQueue->dequeuePosition_.load();
+        for (size_t i = 0; i < this->size(); ++i, ++myPosition, ++otherPosition)
+        {
+            if (!(cells_[myPosition & mask_].data_ == otherQueue->cells_[otherPosition & otherQueue->mask_].data_))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    void BoundedConcurrentQueue<T>::push(T element)
+    {
+        if (!this->tryPush(std::move(element)))
+        {
+            throw structure_error("Queue is full!");
+        }
+    }
+
+    template<typename T>
+    T& BoundedConcurrentQueue<T>::peek()
+    {
+        throw amt::unavailable_function_call("Concurrent queue can't be peeked, use tryPop!");
+    }
+
+    template<typename T>
+    T BoundedConcurrentQueue<T>::pop()
+    {
+        T result;
+        if (!this->tryPop(result))
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+        return result;
+    }
+
+    template<typename T>
+    bool BoundedConcurrentQueue<T>::tryPush(T element)
+    {
+        size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true)
+        {
+            cell = &cells_[position & mask_];
+            const size_t sequence = cell->sequence_.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - position);
+            if (difference == 0)
+            {
+                if (enqueuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = enqueuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->data_ = std::move(element);
+        cell->sequence_.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    bool BoundedConcurrentQueue<T>::tryPop(T& element)
+    {
+        size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true)
+        {
+            cell = &cells_[position & mask_];
+            const size_t sequence = cell->sequence_.load(std::memory_order_acquire);
+            const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>(sequence - (position + 1));
+            if (difference == 0)
+            {
+                if (dequeuePosition_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (difference < 0)
+            {
+                return false;
+            }
+            else
+            {
+                position = dequeuePosition_.load(std::memory_order_relaxed);
+            }
+        }
+
+        element = std::move(cell->data_);
+        cell->sequence_.store(position + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    void BoundedConcurrentQueue<T>::allocateCells(size_t capacity)
+    {
+        size_t roundedCapacity = 1;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity *= 2;
+        }
+
+        cells_ = std::make_unique<Cell[]>(roundedCapacity);
+        for (size_t i = 0; i < roundedCapacity; ++i)
+        {
+            cells_[i].sequence_.store(i, std::memory_order_relaxed);
+        }
+        mask_ = roundedCapacity - 1;
+        enqueuePosition_.store(0, std::memory_order_relaxed);
+        dequeuePosition_.store(0, std::memory_order_relaxed);
+    }
+
+    //----------
+
+    template<typename T>
+    SpscQueue<T>::SpscQueue() :
+        SpscQueue(INIT_CAPACITY)
+    {
+    }
+
+    template<typename T>
+    SpscQueue<T>::SpscQueue(size_t capacity) :
+        mask_(0),
+        head_(0),
+        cachedTail_(0),
+        tail_(0),
+        cachedHead_(0)
+    {
+        this->allocateBuffer(capacity);
+    }
+
+    template<typename T>
+    SpscQueue<T>::SpscQueue(const SpscQueue& other) :
+        SpscQueue(other.getCapacity())
+    {
+        this->assign(other);
+    }
+
+    template<typename T>
+    size_t SpscQueue<T>::getCapacity() const
+    {
+        return mask_ + 1;
+    }
+
+    template<typename T>
+    ADT& SpscQueue<T>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            const SpscQueue<T>& otherQueue = dynamic_cast<const SpscQueue<T>&>(other);
+            if (this->getCapacity() != otherQueue.getCapacity())
+            {
+                this->allocateBuffer(otherQueue.getCapacity());
+            }
+            else
+            {
+                this->clear();
+            }
+
+            const size_t end = otherQueue.tail_.load();
+            for (size_t position = otherQueue.head_.load(); position != end; ++position)
+            {
+                this->push(otherQueue.buffer_[position & otherQueue.mask_]);
+            }
+        }
+        return *this;
+    }
+
+    template<typename T>
+    void SpscQueue<T>::clear()
+    {
+        cachedTail_ = tail_.load(std::memory_order_acquire);
+        head_.store(cachedTail_, std::memory_order_release);
+    }
+
+    template<typename T>
+    size_t SpscQueue<T>::size() const
+    {
+        const size_t head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    template<typename T>
+    bool SpscQueue<T>::isEmpty() const
+    {
+        return this->size() == 0;
+    }
+
+    template<typename T>
+    bool SpscQueue<T>::equals(const ADT& other)
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const SpscQueue<T>* otherQueue = dynamic_cast<const SpscQueue<T>*>(&other);
+        if (otherQueue == nullptr || this->size() != otherQueue->size())
+        {
+            return false;
+        }
+
+        size_t myPosition = head_.load();
+        size_t otherPosition = otherQueue->head_.load();
+        for (size_t i = 0; i < this->size(); ++i, ++myPosition, ++otherPosition)
+        {
+            if (!(buffer_[myPosition & mask_] == otherQueue->buffer_[otherPosition & otherQueue->mask_]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    void SpscQueue<T>::push(T element)
+    {
+        if (!this->tryPush(std::move(element)))
+        {
+            throw structure_error("Queue is full!");
+        }
+    }
+
+    template<typename T>
+    T& SpscQueue<T>::peek()
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_)
+        {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_)
+            {
+                throw std::out_of_range("Queue is empty!");
+            }
+        }
+
+        return buffer_[head & mask_];
+    }
+
+    template<typename T>
+    T SpscQueue<T>::pop()
+    {
+        T result;
+        if (!this->tryPop(result))
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+        return result;
+    }
+
+    template<typename T>
+    bool SpscQueue<T>::tryPush(T element)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - cachedHead_ > mask_)
+        {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+            if (tail - cachedHead_ > mask_)
+            {
+                return false;
+            }
+        }
+
+        buffer_[tail & mask_] = std::move(element);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    bool SpscQueue<T>::tryPop(T& element)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == cachedTail_)
+        {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+            if (head == cachedTail_)
+            {
+                return false;
+            }
+        }
+
+        element = std::move(buffer_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+    size_t SpscQueue<T>::pushN(const T* elements, size_t count)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        const size_t capacity = this->getCapacity();
+        if (capacity - (tail - cachedHead_) < count)
+        {
+            cachedHead_ = head_.load(std::memory_order_acquire);
+        }
+
+        const size_t pushed = std::min(count, capacity - (tail - cachedHead_));
+        const size_t offset = tail & mask_;
+        const size_t firstPart = std::min(pushed, capacity - offset);
+        std::copy(elements, elements + firstPart, buffer_.get() + offset);
+        std::copy(elements + firstPart, elements + pushed, buffer_.get());
+        tail_.store(tail + pushed, std::memory_order_release);
+        return pushed;
+    }
+
+    template<typename T>
+    size_t SpscQueue<T>::popN(T* elements, size_t count)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (cachedTail_ - head < count)
+        {
+            cachedTail_ = tail_.load(std::memory_order_acquire);
+        }
+
+        const size_t popped = std::min(count, cachedTail_ - head);
+        const size_t offset = head & mask_;
+        const size_t firstPart = std::min(popped, this->getCapacity() - offset);
+        std::move(buffer_.get() + offset, buffer_.get() + offset + firstPart, elements);
+        std::move(buffer_.get(), buffer_.get() + popped - firstPart, elements + firstPart);
+        head_.store(head + popped, std::memory_order_release);
+        return popped;
+    }
+
+    template<typename T>
+    void SpscQueue<T>::allocateBuffer(size_t capacity)
+    {
+        size_t roundedCapacity = 1;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity *= 2;
+        }
+
+        buffer_ = std::make_unique<T[]>(roundedCapacity);
+        mask_ = roundedCapacity - 1;
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        cachedHead_ = 0;
+        cachedTail_ = 0;
+    }
+}
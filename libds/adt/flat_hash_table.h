@@ -0,0 +1,538 @@
+#pragma once
+
+#include <libds/adt/table.h>
+#include <libds/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::adt {
+
+    /**
+     * @brief Open addressing hash table probing control bytes a group at a time (SwissTable).
+     *
+     * Items are stored in place in a single array of slots. Each slot has a control byte, which
+     * is EMPTY, DELETED or the low 7 bits of the mixed hash of its key. A lookup compares these
+     * bits with a whole group of control bytes at once (simd::matchBytes), compares keys only in
+     * matching slots and stops at the first group with an EMPTY slot. Groups are probed
+     * quadratically. A removed item leaves a DELETED tombstone only if its group has no EMPTY
+     * slot, since otherwise no probe continues past the group. The table grows when an insert
+     * would leave fewer than 1/8 of the slots EMPTY, and is rebuilt at the same capacity
+     * instead when the slots are taken mostly by tombstones.
+     */
+    template <typename K, typename T>
+    class FlatHashTable :
+        public Table<K, T>
+    {
+    public:
+        using HashFunctionType = std::function<size_t(const K&)>;
+
+    public:
+        FlatHashTable();
+        FlatHashTable(const FlatHashTable& other);
+        FlatHashTable(HashFunctionType hashFunction, size_t capacity);
+        ~FlatHashTable() override;
+
+        ADT& assign(const ADT& other) override;
+        bool equals(const ADT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+
+        void insert(const K& key, T data) override;
+        bool tryFind(const K& key, T*& data) const override;
+        T remove(const K& key) override;
+
+        /**
+         * @brief Looks up the @p count keys at @p keys and sets data[i] to the data of keys[i], or to
+         * nullptr if there is no such key. Returns the number of keys found. The first probed group
+         * and its slots are prefetched for BATCH_SIZE keys before any of them is probed.
+         */
+        size_t tryFindBatch(const K* keys, size_t count, T** data) const;
+
+        /**
+         * @brief Grows the table so that @p size items fit without further growth.
+         */
+        void reserve(size_t size);
+
+        size_t getCapacity() const;
+        double getLoadFactor() const;
+
+        static const size_t INIT_CAPACITY = 16;
+        static constexpr size_t BATCH_SIZE = 16;
+
+    private:
+        using ItemType = TableItem<K, T>;
+
+        static constexpr size_t GROUP_SIZE = simd::BYTE_GROUP_SIZE;
+        static constexpr std::uint8_t EMPTY = 0x80;
+        static constexpr std::uint8_t DELETED = 0xFE;
+
+        struct alignas(GROUP_SIZE) Group
+        {
+            std::uint8_t controls_[GROUP_SIZE];
+        };
+
+        size_t calculateHash(const K& key) const;
+
+        /**
+         * @brief Index of the slot holding @p key, INVALID_INDEX if there is none.
+         */
+        size_t findIndex(const K& key, size_t hash) const;
+
+        /**
+         * @brief Index of the first EMPTY or DELETED slot on the probe sequence of @p hash.
+         */
+        size_t findFreeIndex(size_t hash) const;
+
+        std::uint8_t getControl(size_t index) const;
+        void setControl(size_t index, std::uint8_t control);
+        size_t getMaxSize() const;
+
+        void rehash(size_t capacity);
+        void allocate(size_t capacity);
+        void destroyItems();
+        void deallocate();
+
+        /**
+         * @brief Smallest capacity, a power of two of at least GROUP_SIZE, holding @p size items.
+         */
+        static size_t calculateCapacity(size_t size);
+
+    private:
+        HashFunctionType hashFunction_;
+        std::unique_ptr<Group[]> groups_;
+        ItemType* slots_;
+        size_t groupMask_;
+        size_t size_;
+        size_t growthLeft_;
+
+    public:
+        class FlatHashTableIterator
+        {
+        public:
+            FlatHashTableIterator(const FlatHashTable* table, size_t index);
+            FlatHashTableIterator& operator++();
+            FlatHashTableIterator operator++(int);
+            bool operator==(const FlatHashTableIterator& other) const;
+            bool operator!=(const FlatHashTableIterator& other) const;
+            TableItem<K, T>& operator*();
+
+        private:
+            void skipFreeSlots();
+
+        private:
+            const FlatHashTable* table_;
+            size_t index_;
+        };
+
+        FlatHashTableIterator begin() const;
+        FlatHashTableIterator end() const;
+    };
+
+    //----------
+
+    template <typename K, typename T>
+    FlatHashTable<K, T>::FlatHashTable() :
+        FlatHashTable([](const K& key) { return std::hash<K>()(key); }, INIT_CAPACITY)
+    {
+    }
+
+    template <typename K, typename T>
+    FlatHashTable<K, T>::FlatHashTable(const FlatHashTable& other) :
+        FlatHashTable(other.hashFunction_, other.getCapacity())
+    {
+        this->assign(other);
+    }
+
+    template <typename K, typename T>
+    FlatHashTable<K, T>::FlatHashTable(HashFunctionType hashFunction, size_t capacity) :
+        hashFunction_(hashFunction),
+        slots_(nullptr),
+        groupMask_(0),
+        size_(0),
+        growthLeft_(0)
+    {
+        size_t roundedCapacity = GROUP_SIZE;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity *= 2;
+        }
+        this->allocate(roundedCapacity);
+    }
+
+    template <typename K, typename T>
+    FlatHashTable<K, T>::~FlatHashTable()
+    {
+        this->destroyItems();
+        this->deallocate();
+    }
+
+    template <typename K, typename T>
+    ADT& FlatHashTable<K, T>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            const FlatHashTable& otherTable = dynamic_cast<const FlatHashTable&>(other);
+            this->clear();
+            this->reserve(otherTable.size());
+            for (TableItem<K, T>& otherItem : otherTable)
+            {
+                this->insert(otherItem.key_, otherItem.data_);
+            }
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename T>
+    bool FlatHashTable<K, T>::equals(const ADT& other)
+    {
+        return Table<K, T>::areEqual(*this, other);
+    }
+
+    template <typename K, typename T>
+    void FlatHashTable<K, T>::clear()
+    {
+        this->destroyItems();
+        for (size_t group = 0; group <= groupMask_; ++group)
+        {
+            std::fill(std::begin(groups_[group].controls_), std::end(groups_[group].controls_), EMPTY);
+        }
+        size_ = 0;
+        growthLeft_ = this->getMaxSize();
+    }
+
+    template <typename K, typename T>
+    size_t FlatHashTable<K, T>::size() const
+    {
+        return size_;
+    }
+
+    template <typename K, typename T>
+    bool FlatHashTable<K, T>::isEmpty() const
+    {
+        return this->size() == 0;
+    }
+
+    template <typename K, typename T>
+    void FlatHashTable<K, T>::insert(const K& key, T data)
+    {
+        const size_t hash = this->calculateHash(key);
+        if (this->findIndex(key, hash) != INVALID_INDEX)
+        {
+            throw std::logic_error("Table already contains element associated with given key!");
+        }
+
+        size_t index = this->findFreeIndex(hash);
+        if (growthLeft_ == 0 && this->getControl(index) == EMPTY)
+        {
+            // Many tombstones mean the same capacity is enough once they are dropped.
+            const size_t capacity = this->getCapacity();
+            this->rehash(size_ < this->getMaxSize() / 2 ? capacity : 2 * capacity);
+            index = this->findFreeIndex(hash);
+        }
+
+        if (this->getControl(index) == EMPTY)
+        {
+            --growthLeft_;
+        }
+        new (slots_ + index) ItemType{ key, std::move(data) };
+        this->setControl(index, static_cast<std::uint8_t>(hash & 0x7F));
+        ++size_;
+    }
+
+    template <typename K, typename T>
+    bool FlatHashTable<K, T>::tryFind(const K& key, T*& data) const
+    {
+        const size_t index = this->findIndex(key, this->calculateHash(key));
+        if (index == INVALID_INDEX)
+        {
+            return false;
+        }
+        data = &slots_[index].data_;
+        return true;
+    }
+
+    template <typename K, typename T>
+    T FlatHashTable<K, T>::remove(const K& key)
+    {
+        const size_t index = this->findIndex(key, this->calculateHash(key));
+        if (index == INVALID_INDEX)
+        {
+            throw std::out_of_range("No such key!");
+        }
+
+        T result = std::move(slots_[index].data_);
+        slots_[index].~ItemType();
+        if (simd::matchBytes(groups_[index / GROUP_SIZE].controls_, EMPTY) != 0)
+        {
+            this->setControl(index, EMPTY);
+            ++growthLeft_;
+        }
+        else
+        {
+            this->setControl(index, DELETED);
+        }
+        --size_;
+        return result;
+    }
+
+    template <typename K, typename T>
+    size_t FlatHashTable<K, T>::tryFindBatch(const K* keys, size_t count, T** data) const
+    {
+        size_t found = 0;
+        size_t hashes[BATCH_SIZE];
+        for (size_t first = 0; first < count; first += BATCH_SIZE)
+        {
+            const size_t batchSize = std::min(BATCH_SIZE, count - first);
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                hashes[i] = this->calculateHash(keys[first + i]);
+                const size_t group = (hashes[i] >> 7) & groupMask_;
+                simd::prefetch(groups_[group].controls_);
+                simd::prefetch(slots_ + group * GROUP_SIZE);
+            }
+
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                const size_t index = this->findIndex(keys[first + i], hashes[i]);
+                data[first + i] = index != INVALID_INDEX ? &slots_[index].data_ : nullptr;
+                found += index != INVALID_INDEX ? 1 : 0;
+            }
+        }
+        return found;
+    }
+
+    template <typename K, typename T>
+    void FlatHashTable<K, T>::reserve(size_t size)
+    {
+        const size_t capacity = calculateCapacity(size);
+        if (capacity > this->getCapacity())
+        {
+            this->rehash(capacity);
+        }
+    }
+
+    template <typename K, typename T>
+    size_t FlatHashTable<K, T>::getCapacity() const
+    {
+        return (groupMask_ + 1) * GROUP_SIZE;
+    }
+
+    template <typename K, typename T>
+    double FlatHashTable<K, T>::getLoadFactor() const
+    {
+        return static_cast<double>(size_) / this->getCapacity();
+    }
+
+    template <typename K, typename T>
+    size_t FlatHashTable<K, T>::calculateHash(const K& key) const
+    {
+        return details::mixHash(hashFunction_(key));
+    }
+
+    template <typename K, typename T>
+    size_t FlatHashTable<K, T>::findIndex(const K& key, size_t hash) const
+    {
+        const std::uint8_t control = static_cast<std::uint8_t>(hash & 0x7F);
+        size_t group = (hash >> 7) & groupMask_;
+        for (size_t step = 1; ; ++step)
+        {
+            const std::uint8_t* controls = groups_[group].controls_;
+            for (unsigned int mask = simd::matchBytes(controls, control); mask != 0; mask &= mask - 1)
+            {
+                const size_t index = group * GROUP_SIZE + simd::details::firstSetBit(mask);
+                if (slots_[index].key_ == key)
+                {
+                    return index;
+                }
+            }
+
+            if (simd::matchBytes(controls, EMPTY) != 0)
+            {
+                return INVALID_INDEX;
+            }
+            group = (group + step) & groupMask_;
+        }
+    }
+
+    template <typename K, typename T>
+    size_t FlatHashTable<K, T>::findFreeIndex(size_t hash) const
+    {
+        size_t group = (hash >> 7) & groupMask_;
+        for (size_t step = 1; ; ++step)
+        {
+            const unsigned int mask = simd::matchHighBits(groups_[group].controls_);
+            if (mask != 0)
+            {
+                return group * GROUP_SIZE + simd::details::firstSetBit(mask);
+            }
+            group = (group + step) & groupMask_;
+        }
+    }
+
+    template <typename K, typename T>
+    std::uint8_t FlatHashTable<K, T>::getControl(size_t index) const
+    {
+        return groups_[index / GROUP_SIZE].controls_[index % GROUP_SIZE];
+    }
+
+    template <typename K, typename T>
+    void FlatHashTable<K, T>::setControl(size_t index, std::uint8_t control)
+    {
+        groups_[index / GROUP_SIZE].controls_[index % GROUP_SIZE] = control;
+    }
+
+    template <typename K, typename T>
+    size_t FlatHashTable<K, T>::getMaxSize() const
+    {
+        const size_t capacity = this->getCapacity();
+        return capacity - capacity / 8;
+    }
+
+    template <typename K, typename T>
+    void FlatHashTable<K, T>::rehash(size_t capacity)
+    {
+        std::unique_ptr<Group[]> oldGroups = std::move(groups_);
+        ItemType* oldSlots = slots_;
+        const size_t oldCapacity = this->getCapacity();
+        const size_t oldSize = size_;
+        this->allocate(capacity);
+
+        for (size_t oldIndex = 0; oldIndex < oldCapacity; ++oldIndex)
+        {
+            if ((oldGroups[oldIndex / GROUP_SIZE].controls_[oldIndex % GROUP_SIZE] & EMPTY) == 0)
+            {
+                ItemType& item = oldSlots[oldIndex];
+                const size_t hash = this->calculateHash(item.key_);
+                const size_t index = this->findFreeIndex(hash);
+                new (slots_ + index) ItemType{ std::move(item) };
+                this->setControl(index, static_cast<std::uint8_t>(hash & 0x7F));
+                item.~ItemType();
+            }
+        }
+        std::allocator<ItemType>().deallocate(oldSlots, oldCapacity);
+
+        size_ = oldSize;
+        growthLeft_ -= oldSize;
+    }
+
+    template <typename K, typename T>
+    void FlatHashTable<K, T>::allocate(size_t capacity)
+    {
+        const size_t groupCount = capacity / GROUP_SIZE;
+        groups_ = std::make_unique<Group[]>(groupCount);
+        for (size_t group = 0; group < groupCount; ++group)
+        {
+            std::fill(std::begin(groups_[group].controls_), std::end(groups_[group].controls_), EMPTY);
+        }
+        slots_ = std::allocator<ItemType>().allocate(groupCount * GROUP_SIZE);
+        groupMask_ = groupCount - 1;
+        size_ = 0;
+        growthLeft_ = this->getMaxSize();
+    }
+
+    template <typename K, typename T>
+    void FlatHashTable<K, T>::destroyItems()
+    {
+        const size_t capacity = this->getCapacity();
+        for (size_t index = 0; index < capacity; ++index)
+        {
+            if ((this->getControl(index) & EMPTY) == 0)
+            {
+                slots_[index].~ItemType();
+            }
+        }
+    }
+
+    template <typename K, typename T>
+    void FlatHashTable<K, T>::deallocate()
+    {
+        std::allocator<ItemType>().deallocate(slots_, this->getCapacity());
+        slots_ = nullptr;
+        groups_.reset();
+    }
+
+    template <typename K, typename T>
+    size_t FlatHashTable<K, T>::calculateCapacity(size_t size)
+    {
+        size_t capacity = GROUP_SIZE;
+        while (capacity - capacity / 8 < size)
+        {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    //----------
+
+    template <typename K, typename T>
+    FlatHashTable<K, T>::FlatHashTableIterator::FlatHashTableIterator(const FlatHashTable* table, size_t index) :
+        table_(table),
+        index_(index)
+    {
+        this->skipFreeSlots();
+    }
+
+    template <typename K, typename T>
+    typename FlatHashTable<K, T>::FlatHashTableIterator& FlatHashTable<K, T>::FlatHashTableIterator::operator++()
+    {
+        ++index_;
+        this->skipFreeSlots();
+        return *this;
+    }
+
+    template <typename K, typename T>
+    typename FlatHashTable<K, T>::FlatHashTableIterator FlatHashTable<K, T>::FlatHashTableIterator::operator++(int)
+    {
+        FlatHashTableIterator tmp(*this);
+        this->operator++();
+        return tmp;
+    }
+
+    template <typename K, typename T>
+    bool FlatHashTable<K, T>::FlatHashTableIterator::operator==(const FlatHashTableIterator& other) const
+    {
+        return table_ == other.table_ && index_ == other.index_;
+    }
+
+    template <typename K, typename T>
+    bool FlatHashTable<K, T>::FlatHashTableIterator::operator!=(const FlatHashTableIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    template <typename K, typename T>
+    TableItem<K, T>& FlatHashTable<K, T>::FlatHashTableIterator::operator*()
+    {
+        return table_->slots_[index_];
+    }
+
+    template <typename K, typename T>
+    void FlatHashTable<K, T>::FlatHashTableIterator::skipFreeSlots()
+    {
+        const size_t capacity = table_->getCapacity();
+        while (index_ < capacity && (table_->getControl(index_) & EMPTY) != 0)
+        {
+            ++index_;
+        }
+    }
+
+    template <typename K, typename T>
+    typename FlatHashTable<K, T>::FlatHashTableIterator FlatHashTable<K, T>::begin() const
+    {
+        return FlatHashTableIterator(this, 0);
+    }
+
+    template <typename K, typename T>
+    typename FlatHashTable<K, T>::FlatHashTableIterator FlatHashTable<K, T>::end() const
+    {
+        return FlatHashTableIterator(this, this->getCapacity());
+    }
+}
@@ -3,6 +3,7 @@
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_sequence.h>
 #include <libds/amt/explicit_sequence.h>
+#include <type_traits>
 
 namespace ds::adt {
 
@@ -134,6 +135,11 @@ namespace ds::adt {
     template<typename T, typename SequenceType>
     size_t GeneralList<T, SequenceType>::calculateIndex(T element)
     {
+        if constexpr (std::is_base_of_v<amt::IS<T>, SequenceType>)
+        {
+            return this->getSequence()->indexOf(element);
+        }
+
         size_t result = 0;
         typename SequenceType::BlockType* block = this->getSequence()->findBlockWithProperty(
             [&](typename SequenceType::BlockType* b)
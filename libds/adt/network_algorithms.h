@@ -0,0 +1,440 @@
+#pragma once
+
+#include <libds/constants.h>
+#include <libds/adt/priority_queue.h>
+#include <libds/amt/explicit_network.h>
+#include <libds/amt/frozen_network.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ds::adt
+{
+    /**
+     *  @brief Graph algorithms over networks.
+     *
+     *  All algorithms run on the compressed sparse row view of a network (amt::FrozenNetwork)
+     *  and identify nodes by their index in it, which is their position in the gate.
+     *  Overloads taking an amt::ExplicitNetwork freeze it first, so results are indexed
+     *  by gate order of the original network. Relations are treated as undirected.
+     */
+
+    /**
+     *  @brief Returns the BFS level of every node reachable from @p start,
+     *  INVALID_INDEX for unreachable nodes.
+     */
+    template <typename SourceBlockType>
+    std::vector<size_t> breadthFirstSearch(const amt::FrozenNetwork<SourceBlockType>& network, size_t start);
+
+    /**
+     *  @brief Returns indices of nodes reachable from @p start in depth-first pre-order.
+     */
+    template <typename SourceBlockType>
+    std::vector<size_t> depthFirstSearch(const amt::FrozenNetwork<SourceBlockType>& network, size_t start);
+
+    /**
+     *  @brief Returns the component number of every node.
+     *  Components are numbered from 0 in the order of their first node.
+     */
+    template <typename SourceBlockType>
+    std::vector<size_t> connectedComponents(const amt::FrozenNetwork<SourceBlockType>& network);
+
+    /**
+     *  @brief Returns the length of the shortest path from @p start to every node,
+     *  maximum of @p W for unreachable nodes. Weights must not be negative.
+     */
+    template <typename W, typename SourceBlockType>
+    std::vector<W> dijkstra(
+        const amt::FrozenNetwork<SourceBlockType>& network,
+        size_t start,
+        std::function<W(const typename amt::FrozenNetwork<SourceBlockType>::BlockType&, const typename amt::FrozenNetwork<SourceBlockType>::BlockType&)> weight
+    );
+
+    /**
+     *  @brief Direction-optimizing breadth-first search using @p threadCount threads.
+     *
+     *  Small frontiers are expanded top-down, large frontiers bottom-up by checking
+     *  whether some neighbour of every unvisited node lies in the frontier.
+     *  Returns the same levels as breadthFirstSearch.
+     */
+    template <typename SourceBlockType>
+    std::vector<size_t> parallelBreadthFirstSearch(
+        const amt::FrozenNetwork<SourceBlockType>& network,
+        size_t start,
+        size_t threadCount = std::thread::hardware_concurrency()
+    );
+
+    template <typename BlockType, typename GateType>
+    std::vector<size_t> breadthFirstSearch(const amt::ExplicitNetwork<BlockType, GateType>& network, const BlockType& start);
+
+    template <typename BlockType, typename GateType>
+    std::vector<size_t> depthFirstSearch(const amt::ExplicitNetwork<BlockType, GateType>& network, const BlockType& start);
+
+    template <typename BlockType, typename GateType>
+    std::vector<size_t> connectedComponents(const amt::ExplicitNetwork<BlockType, GateType>& network);
+
+    /**
+     *  @brief Dijkstra over an explicit network, @p weight gets the original nodes.
+     */
+    template <typename W, typename BlockType, typename GateType>
+    std::vector<W> dijkstra(
+        const amt::ExplicitNetwork<BlockType, GateType>& network,
+        const BlockType& start,
+        std::function<W(const typename amt::Network<BlockType>::NodeType&, const typename amt::Network<BlockType>::NodeType&)> weight
+    );
+
+    //----------
+
+    namespace details
+    {
+        template <typename SourceBlockType>
+        void checkStart(const amt::FrozenNetwork<SourceBlockType>& network, size_t start)
+        {
+            if (start >= network.size())
+            {
+                throw std::out_of_range("Invalid start node!");
+            }
+        }
+
+        template <typename SourceBlockType>
+        size_t findFrozenIndex(const amt::FrozenNetwork<SourceBlockType>& network, const SourceBlockType& node)
+        {
+            for (size_t i = 0; i < network.size(); ++i)
+            {
+                if (network.accessSource(*network.accessAt(i)) == &node)
+                {
+                    return i;
+                }
+            }
+            throw std::out_of_range("Node is not in the network!");
+        }
+
+        /**
+         *  @brief Splits [0, count) into @p threadCount chunks and runs @p operation(begin, end, thread) on each.
+         *  Small ranges are processed by the calling thread.
+         */
+        inline void parallelFor(size_t threadCount, size_t count, const std::function<void(size_t, size_t, size_t)>& operation)
+        {
+            const size_t MIN_CHUNK_SIZE = 1024;
+            if (threadCount <= 1 || count <= MIN_CHUNK_SIZE)
+            {
+                operation(0, count, 0);
+                return;
+            }
+
+            const size_t chunkSize = std::max(MIN_CHUNK_SIZE, (count + threadCount - 1) / threadCount);
+            std::vector<std::thread> threads;
+            for (size_t thread = 0, begin = chunkSize; begin < count; ++thread, begin += chunkSize)
+            {
+                threads.emplace_back(operation, begin, std::min(begin + chunkSize, count), thread + 1);
+            }
+            operation(0, std::min(chunkSize, count), 0);
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+    }
+
+    //----------
+
+    template <typename SourceBlockType>
+    std::vector<size_t> breadthFirstSearch(const amt::FrozenNetwork<SourceBlockType>& network, size_t start)
+    {
+        details::checkStart(network, start);
+
+        std::vector<size_t> levels(network.size(), INVALID_INDEX);
+        std::vector<size_t> queue;
+        queue.reserve(network.size());
+
+        levels[start] = 0;
+        queue.push_back(start);
+        for (size_t head = 0; head < queue.size(); ++head)
+        {
+            const size_t current = queue[head];
+            const auto& node = *network.accessAt(current);
+            for (size_t i = 0; i < network.degree(node); ++i)
+            {
+                const size_t neighbour = network.calculateRelationIndex(node, i);
+                if (levels[neighbour] == INVALID_INDEX)
+                {
+                    levels[neighbour] = levels[current] + 1;
+                    queue.push_back(neighbour);
+                }
+            }
+        }
+
+        return levels;
+    }
+
+    template <typename SourceBlockType>
+    std::vector<size_t> depthFirstSearch(const amt::FrozenNetwork<SourceBlockType>& network, size_t start)
+    {
+        details::checkStart(network, start);
+
+        std::vector<bool> visited(network.size(), false);
+        std::vector<size_t> order;
+        // node and order of its next relation to follow
+        std::vector<std::pair<size_t, size_t>> stack;
+
+        visited[start] = true;
+        order.push_back(start);
+        stack.emplace_back(start, 0);
+        while (!stack.empty())
+        {
+            auto& [current, relation] = stack.back();
+            const auto& node = *network.accessAt(current);
+            if (relation == network.degree(node))
+            {
+                stack.pop_back();
+                continue;
+            }
+
+            const size_t neighbour = network.calculateRelationIndex(node, relation++);
+            if (!visited[neighbour])
+            {
+                visited[neighbour] = true;
+                order.push_back(neighbour);
+                stack.emplace_back(neighbour, 0);
+            }
+        }
+
+        return order;
+    }
+
+    template <typename SourceBlockType>
+    std::vector<size_t> connectedComponents(const amt::FrozenNetwork<SourceBlockType>& network)
+    {
+        std::vector<size_t> components(network.size(), INVALID_INDEX);
+        std::vector<size_t> queue;
+        queue.reserve(network.size());
+
+        size_t componentCount = 0;
+        for (size_t root = 0; root < network.size(); ++root)
+        {
+            if (components[root] != INVALID_INDEX)
+            {
+                continue;
+            }
+
+            queue.clear();
+            components[root] = componentCount;
+            queue.push_back(root);
+            for (size_t head = 0; head < queue.size(); ++head)
+            {
+                const auto& node = *network.accessAt(queue[head]);
+                for (size_t i = 0; i < network.degree(node); ++i)
+                {
+                    const size_t neighbour = network.calculateRelationIndex(node, i);
+                    if (components[neighbour] == INVALID_INDEX)
+                    {
+                        components[neighbour] = componentCount;
+                        queue.push_back(neighbour);
+                    }
+                }
+            }
+            ++componentCount;
+        }
+
+        return components;
+    }
+
+    template <typename W, typename SourceBlockType>
+    std::vector<W> dijkstra(
+        const amt::FrozenNetwork<SourceBlockType>& network,
+        size_t start,
+        std::function<W(const typename amt::FrozenNetwork<SourceBlockType>::BlockType&, const typename amt::FrozenNetwork<SourceBlockType>::BlockType&)> weight
+    )
+    {
+        details::checkStart(network, start);
+
+        std::vector<W> distances(network.size(), (std::numeric_limits<W>::max)());
+        std::vector<bool> settled(network.size(), false);
+        // Nodes are pushed again instead of decreasing their key, the stale entries are skipped.
+        BinaryHeap<W, size_t> heap;
+
+        distances[start] = W();
+        heap.push(distances[start], start);
+        while (!heap.isEmpty())
+        {
+            const size_t current = heap.pop();
+            if (settled[current])
+            {
+                continue;
+            }
+            settled[current] = true;
+
+            const auto& node = *network.accessAt(current);
+            for (size_t i = 0; i < network.degree(node); ++i)
+            {
+                const size_t neighbour = network.calculateRelationIndex(node, i);
+                const W relationWeight = weight(node, *network.accessAt(neighbour));
+                if (relationWeight < W())
+                {
+                    throw std::invalid_argument("Negative relation weight!");
+                }
+
+                const W distance = distances[current] + relationWeight;
+                if (!settled[neighbour] && distance < distances[neighbour])
+                {
+                    distances[neighbour] = distance;
+                    heap.push(distance, neighbour);
+                }
+            }
+        }
+
+        return distances;
+    }
+
+    template <typename SourceBlockType>
+    std::vector<size_t> parallelBreadthFirstSearch(
+        const amt::FrozenNetwork<SourceBlockType>& network,
+        size_t start,
+        size_t threadCount
+    )
+    {
+        // Switching thresholds from Beamer et al., Direction-Optimizing Breadth-First Search.
+        const size_t ALPHA = 14;
+        const size_t BETA = 24;
+
+        details::checkStart(network, start);
+        threadCount = std::max<size_t>(threadCount, 1);
+
+        const size_t nodeCount = network.size();
+        std::vector<std::atomic<size_t>> levels(nodeCount);
+        for (std::atomic<size_t>& level : levels)
+        {
+            level.store(INVALID_INDEX, std::memory_order_relaxed);
+        }
+
+        std::vector<size_t> frontier({start});
+        std::vector<std::vector<size_t>> nextFrontiers(threadCount);
+        levels[start].store(0, std::memory_order_relaxed);
+
+        size_t unexploredRelations = network.relationCount() - network.degree(*network.accessAt(start));
+        size_t frontierRelations = network.degree(*network.accessAt(start));
+        bool bottomUp = false;
+
+        for (size_t level = 0; !frontier.empty(); ++level)
+        {
+            if (!bottomUp && frontierRelations > unexploredRelations / ALPHA)
+            {
+                bottomUp = true;
+            }
+            else if (bottomUp && frontier.size() < nodeCount / BETA)
+            {
+                bottomUp = false;
+            }
+
+            if (bottomUp)
+            {
+                details::parallelFor(threadCount, nodeCount, [&](size_t begin, size_t end, size_t thread)
+                    {
+                        std::vector<size_t>& next = nextFrontiers[thread];
+                        for (size_t current = begin; current < end; ++current)
+                        {
+                            if (levels[current].load(std::memory_order_relaxed) != INVALID_INDEX)
+                            {
+                                continue;
+                            }
+
+                            const auto& node = *network.accessAt(current);
+                            for (size_t i = 0; i < network.degree(node); ++i)
+                            {
+                                if (levels[network.calculateRelationIndex(node, i)].load(std::memory_order_relaxed) == level)
+                                {
+                                    levels[current].store(level + 1, std::memory_order_relaxed);
+                                    next.push_back(current);
+                                    break;
+                                }
+                            }
+                        }
+                    });
+            }
+            else
+            {
+                details::parallelFor(threadCount, frontier.size(), [&](size_t begin, size_t end, size_t thread)
+                    {
+                        std::vector<size_t>& next = nextFrontiers[thread];
+                        for (size_t f = begin; f < end; ++f)
+                        {
+                            const auto& node = *network.accessAt(frontier[f]);
+                            for (size_t i = 0; i < network.degree(node); ++i)
+                            {
+                                const size_t neighbour = network.calculateRelationIndex(node, i);
+                                size_t expected = INVALID_INDEX;
+                                if (levels[neighbour].load(std::memory_order_relaxed) == INVALID_INDEX &&
+                                    levels[neighbour].compare_exchange_strong(expected, level + 1, std::memory_order_relaxed))
+                                {
+                                    next.push_back(neighbour);
+                                }
+                            }
+                        }
+                    });
+            }
+
+            frontier.clear();
+            frontierRelations = 0;
+            for (std::vector<size_t>& next : nextFrontiers)
+            {
+                for (size_t node : next)
+                {
+                    frontierRelations += network.degree(*network.accessAt(node));
+                }
+                frontier.insert(frontier.end(), next.begin(), next.end());
+                next.clear();
+            }
+            unexploredRelations -= frontierRelations;
+        }
+
+        std::vector<size_t> result(nodeCount);
+        for (size_t i = 0; i < nodeCount; ++i)
+        {
+            result[i] = levels[i].load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    //----------
+
+    template <typename BlockType, typename GateType>
+    std::vector<size_t> breadthFirstSearch(const amt::ExplicitNetwork<BlockType, GateType>& network, const BlockType& start)
+    {
+        const amt::FrozenNetwork<BlockType> frozen = amt::freeze(network);
+        return breadthFirstSearch(frozen, details::findFrozenIndex(frozen, start));
+    }
+
+    template <typename BlockType, typename GateType>
+    std::vector<size_t> depthFirstSearch(const amt::ExplicitNetwork<BlockType, GateType>& network, const BlockType& start)
+    {
+        const amt::FrozenNetwork<BlockType> frozen = amt::freeze(network);
+        return depthFirstSearch(frozen, details::findFrozenIndex(frozen, start));
+    }
+
+    template <typename BlockType, typename GateType>
+    std::vector<size_t> connectedComponents(const amt::ExplicitNetwork<BlockType, GateType>& network)
+    {
+        return connectedComponents(amt::freeze(network));
+    }
+
+    template <typename W, typename BlockType, typename GateType>
+    std::vector<W> dijkstra(
+        const amt::ExplicitNetwork<BlockType, GateType>& network,
+        const BlockType& start,
+        std::function<W(const typename amt::Network<BlockType>::NodeType&, const typename amt::Network<BlockType>::NodeType&)> weight
+    )
+    {
+        using FrozenBlockType = typename amt::FrozenNetwork<BlockType>::BlockType;
+
+        const amt::FrozenNetwork<BlockType> frozen = amt::freeze(network);
+        return dijkstra<W, BlockType>(frozen, details::findFrozenIndex(frozen, start), [&frozen, &weight](const FrozenBlockType& nodeFrom, const FrozenBlockType& nodeTo)
+            {
+                return weight(*frozen.accessSource(nodeFrom), *frozen.accessSource(nodeTo));
+            });
+    }
+}
@@ -3,6 +3,9 @@
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_sequence.h>
 #include <libds/amt/explicit_sequence.h>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
 
 namespace ds::adt {
 
@@ -39,11 +42,40 @@ namespace ds::adt {
         T& peek() override;
         T pop() override;
 
+        /**
+         * @brief Grows the ring so that it holds at least @p capacity elements without further growth.
+         */
+        void reserve(size_t capacity);
+
+        /**
+         * @brief Pushes the elements of [@p first, @p last) in order.
+         * A forward range grows the ring at most once.
+         */
+        template<typename InputIterator>
+        void pushRange(InputIterator first, InputIterator last);
+
+        /**
+         * @brief Moves up to @p count first elements to the array starting at @p elements.
+         * @return Number of popped elements.
+         */
+        size_t popInto(T* elements, size_t count);
+
         static const int INIT_CAPACITY = 100;
 
     private:
         amt::CIS<T>* getSequence() const;
 
+        /**
+         * @brief Doubles the capacity, or grows it to @p requiredCapacity if that is more, when it's insufficient.
+         */
+        void ensureCapacity(size_t requiredCapacity);
+
+        /**
+         * @brief Appends blocks up to @p newCapacity and moves the wrapped front part of the ring
+         * behind the old end, so that the elements stay in one cyclic run starting at removalIndex_.
+         */
+        void grow(size_t newCapacity);
+
     private:
         size_t insertionIndex_;
         size_t removalIndex_;
@@ -103,9 +135,16 @@ namespace ds::adt {
     template<typename T>
     ADT& ImplicitQueue<T>::assign(const ADT& other)
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (this != &other)
+        {
+            const ImplicitQueue<T>& otherQueue = dynamic_cast<const ImplicitQueue<T>&>(other);
+            ADS<T>::assign(otherQueue);
+            insertionIndex_ = otherQueue.insertionIndex_;
+            removalIndex_ = otherQueue.removalIndex_;
+            size_ = otherQueue.size_;
+        }
+
+        return *this;
     }
 
     template<typename T>
@@ -124,33 +163,127 @@ namespace ds::adt {
     template<typename T>
     bool ImplicitQueue<T>::equals(const ADT& other)
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const ImplicitQueue<T>* otherQueue = dynamic_cast<const ImplicitQueue<T>*>(&other);
+        if (otherQueue == nullptr || size_ != otherQueue->size_)
+        {
+            return false;
+        }
+
+        const amt::CIS<T>* mySequence = this->getSequence();
+        const amt::CIS<T>* otherSequence = otherQueue->getSequence();
+        size_t myIndex = removalIndex_;
+        size_t otherIndex = otherQueue->removalIndex_;
+        for (size_t i = 0; i < size_; ++i)
+        {
+            if (!(mySequence->peek(myIndex)->data_ == otherSequence->peek(otherIndex)->data_))
+            {
+                return false;
+            }
+            myIndex = myIndex + 1 == this->getCapacity() ? 0 : myIndex + 1;
+            otherIndex = otherIndex + 1 == otherQueue->getCapacity() ? 0 : otherIndex + 1;
+        }
+
+        return true;
     }
 
     template<typename T>
     void ImplicitQueue<T>::push(T element)
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        this->ensureCapacity(size_ + 1);
+        this->getSequence()->access(insertionIndex_)->data_ = element;
+        insertionIndex_ = insertionIndex_ + 1 == this->getCapacity() ? 0 : insertionIndex_ + 1;
+        ++size_;
     }
 
     template<typename T>
     T& ImplicitQueue<T>::peek()
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (this->isEmpty())
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+
+        return this->getSequence()->access(removalIndex_)->data_;
     }
 
     template<typename T>
     T ImplicitQueue<T>::pop()
     {
-        // TODO 09
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        if (this->isEmpty())
+        {
+            throw std::out_of_range("Queue is empty!");
+        }
+
+        T result = this->getSequence()->access(removalIndex_)->data_;
+        removalIndex_ = removalIndex_ + 1 == this->getCapacity() ? 0 : removalIndex_ + 1;
+        --size_;
+        return result;
+    }
+
+    template<typename T>
+    void ImplicitQueue<T>::reserve(size_t capacity)
+    {
+        if (capacity > this->getCapacity())
+        {
+            this->grow(capacity);
+        }
+    }
+
+    template<typename T>
+    template<typename InputIterator>
+    void ImplicitQueue<T>::pushRange(InputIterator first, InputIterator last)
+    {
+        using Category = typename std::iterator_traits<InputIterator>::iterator_category;
+        if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>)
+        {
+            const size_t count = static_cast<size_t>(std::distance(first, last));
+            if (count == 0)
+            {
+                return;
+            }
+
+            this->ensureCapacity(size_ + count);
+            const size_t capacity = this->getCapacity();
+            amt::MemoryBlock<T>* blocks = this->getSequence()->access(0);
+            for (; first != last; ++first)
+            {
+                blocks[insertionIndex_].data_ = *first;
+                insertionIndex_ = insertionIndex_ + 1 == capacity ? 0 : insertionIndex_ + 1;
+            }
+            size_ += count;
+        }
+        else
+        {
+            for (; first != last; ++first)
+            {
+                this->push(*first);
+            }
+        }
+    }
+
+    template<typename T>
+    size_t ImplicitQueue<T>::popInto(T* elements, size_t count)
+    {
+        const size_t popped = std::min(count, size_);
+        if (popped == 0)
+        {
+            return 0;
+        }
+
+        const size_t capacity = this->getCapacity();
+        amt::MemoryBlock<T>* blocks = this->getSequence()->access(0);
+        for (size_t i = 0; i < popped; ++i)
+        {
+            elements[i] = std::move(blocks[removalIndex_].data_);
+            removalIndex_ = removalIndex_ + 1 == capacity ? 0 : removalIndex_ + 1;
+        }
+        size_ -= popped;
+        return popped;
     }
 
     template<typename T>
@@ -159,6 +292,41 @@ namespace ds::adt {
         return dynamic_cast<amt::CIS<T>*>(this->memoryStructure_);
     }
 
+    template<typename T>
+    void ImplicitQueue<T>::ensureCapacity(size_t requiredCapacity)
+    {
+        const size_t capacity = this->getCapacity();
+        if (requiredCapacity > capacity)
+        {
+            this->grow(std::max(requiredCapacity, 2 * capacity));
+        }
+    }
+
+    template<typename T>
+    void ImplicitQueue<T>::grow(size_t newCapacity)
+    {
+        amt::CIS<T>* sequence = this->getSequence();
+        const size_t capacity = this->getCapacity();
+        sequence->reserveCapacity(newCapacity);
+        for (size_t i = capacity; i < newCapacity; ++i)
+        {
+            sequence->insertLast();
+        }
+
+        if (removalIndex_ + size_ > capacity)
+        {
+            // Wrapped elements at [0, wrapped) continue behind the old end. Moving them in
+            // ascending order never overwrites one that wasn't moved yet.
+            const size_t wrapped = removalIndex_ + size_ - capacity;
+            amt::MemoryBlock<T>* blocks = sequence->access(0);
+            for (size_t i = 0; i < wrapped; ++i)
+            {
+                blocks[(capacity + i) % newCapacity].data_ = std::move(blocks[i].data_);
+            }
+        }
+        insertionIndex_ = (removalIndex_ + size_) % newCapacity;
+    }
+
     template<typename T>
     ExplicitQueue<T>::ExplicitQueue() :
         ADS<T>(new amt::SinglyLS<T>())
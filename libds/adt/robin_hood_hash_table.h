@@ -0,0 +1,524 @@
+#pragma once
+
+#include <libds/adt/table.h>
+#include <libds/simd.h>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace ds::adt {
+
+    /**
+     * @brief Open addressing hash table with linear probing and Robin Hood displacement.
+     *
+     * Every slot remembers the probe length of its item, i.e. how far the item lies from the
+     * slot its hash points to. An insert takes the slot of any item closer to its home than
+     * the inserted one and continues with the displaced item, which keeps probe lengths short
+     * and close to each other. A lookup therefore stops as soon as it meets an item closer to
+     * its home than the searched key would be. A remove shifts the following displaced items
+     * one slot back instead of leaving a tombstone. It needs no SIMD, and grows when more than
+     * 7/8 of the slots are taken.
+     */
+    template <typename K, typename T>
+    class RobinHoodHashTable :
+        public Table<K, T>
+    {
+    public:
+        using HashFunctionType = std::function<size_t(const K&)>;
+
+        /**
+         * @brief Probe lengths of the stored items, 0 for an item in its home slot.
+         */
+        struct ProbeLengthStatistics
+        {
+            size_t max_;
+            double mean_;
+            double variance_;
+        };
+
+    public:
+        RobinHoodHashTable();
+        RobinHoodHashTable(const RobinHoodHashTable& other);
+        RobinHoodHashTable(HashFunctionType hashFunction, size_t capacity);
+        ~RobinHoodHashTable() override;
+
+        ADT& assign(const ADT& other) override;
+        bool equals(const ADT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+
+        void insert(const K& key, T data) override;
+        bool tryFind(const K& key, T*& data) const override;
+        T remove(const K& key) override;
+
+        /**
+         * @brief Looks up the @p count keys at @p keys and sets data[i] to the data of keys[i], or to
+         * nullptr if there is no such key. Returns the number of keys found. The home slots of
+         * BATCH_SIZE keys are prefetched before any of them is probed.
+         */
+        size_t tryFindBatch(const K* keys, size_t count, T** data) const;
+
+        /**
+         * @brief Grows the table so that @p size items fit without further growth.
+         */
+        void reserve(size_t size);
+
+        size_t getCapacity() const;
+        double getLoadFactor() const;
+        ProbeLengthStatistics getProbeLengthStatistics() const;
+
+        static const size_t INIT_CAPACITY = 16;
+        static constexpr size_t BATCH_SIZE = 16;
+
+    private:
+        using ItemType = TableItem<K, T>;
+
+        /**
+         * @brief Value of distances_ marking an empty slot, occupied slots store probe length + 1.
+         */
+        static constexpr std::uint32_t EMPTY = 0;
+
+        size_t calculateHomeIndex(const K& key) const;
+
+        /**
+         * @brief Index of the slot holding @p key, probed from its @p homeIndex, INVALID_INDEX if there is none.
+         */
+        size_t findIndex(const K& key, size_t homeIndex) const;
+
+        /**
+         * @brief Places @p item, whose key isn't in the table yet, displacing closer items.
+         */
+        void place(ItemType&& item);
+
+        size_t getMaxSize() const;
+        void rehash(size_t capacity);
+        void allocate(size_t capacity);
+        void destroyItems();
+        void deallocate();
+
+        /**
+         * @brief Smallest power of two capacity holding @p size items.
+         */
+        static size_t calculateCapacity(size_t size);
+
+    private:
+        HashFunctionType hashFunction_;
+        std::unique_ptr<std::uint32_t[]> distances_;
+        ItemType* slots_;
+        size_t mask_;
+        size_t size_;
+
+    public:
+        class RobinHoodHashTableIterator
+        {
+        public:
+            RobinHoodHashTableIterator(const RobinHoodHashTable* table, size_t index);
+            RobinHoodHashTableIterator& operator++();
+            RobinHoodHashTableIterator operator++(int);
+            bool operator==(const RobinHoodHashTableIterator& other) const;
+            bool operator!=(const RobinHoodHashTableIterator& other) const;
+            TableItem<K, T>& operator*();
+
+        private:
+            void skipEmptySlots();
+
+        private:
+            const RobinHoodHashTable* table_;
+            size_t index_;
+        };
+
+        RobinHoodHashTableIterator begin() const;
+        RobinHoodHashTableIterator end() const;
+    };
+
+    //----------
+
+    template <typename K, typename T>
+    RobinHoodHashTable<K, T>::RobinHoodHashTable() :
+        RobinHoodHashTable([](const K& key) { return std::hash<K>()(key); }, INIT_CAPACITY)
+    {
+    }
+
+    template <typename K, typename T>
+    RobinHoodHashTable<K, T>::RobinHoodHashTable(const RobinHoodHashTable& other) :
+        RobinHoodHashTable(other.hashFunction_, other.getCapacity())
+    {
+        this->assign(other);
+    }
+
+    template <typename K, typename T>
+    RobinHoodHashTable<K, T>::RobinHoodHashTable(HashFunctionType hashFunction, size_t capacity) :
+        hashFunction_(hashFunction),
+        slots_(nullptr),
+        mask_(0),
+        size_(0)
+    {
+        size_t roundedCapacity = 1;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity *= 2;
+        }
+        this->allocate(roundedCapacity);
+    }
+
+    template <typename K, typename T>
+    RobinHoodHashTable<K, T>::~RobinHoodHashTable()
+    {
+        this->destroyItems();
+        this->deallocate();
+    }
+
+    template <typename K, typename T>
+    ADT& RobinHoodHashTable<K, T>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            const RobinHoodHashTable& otherTable = dynamic_cast<const RobinHoodHashTable&>(other);
+            this->clear();
+            this->reserve(otherTable.size());
+            for (TableItem<K, T>& otherItem : otherTable)
+            {
+                this->insert(otherItem.key_, otherItem.data_);
+            }
+        }
+
+        return *this;
+    }
+
+    template <typename K, typename T>
+    bool RobinHoodHashTable<K, T>::equals(const ADT& other)
+    {
+        return Table<K, T>::areEqual(*this, other);
+    }
+
+    template <typename K, typename T>
+    void RobinHoodHashTable<K, T>::clear()
+    {
+        this->destroyItems();
+        std::fill(distances_.get(), distances_.get() + this->getCapacity(), EMPTY);
+        size_ = 0;
+    }
+
+    template <typename K, typename T>
+    size_t RobinHoodHashTable<K, T>::size() const
+    {
+        return size_;
+    }
+
+    template <typename K, typename T>
+    bool RobinHoodHashTable<K, T>::isEmpty() const
+    {
+        return this->size() == 0;
+    }
+
+    template <typename K, typename T>
+    void RobinHoodHashTable<K, T>::insert(const K& key, T data)
+    {
+        if (this->findIndex(key, this->calculateHomeIndex(key)) != INVALID_INDEX)
+        {
+            throw std::logic_error("Table already contains element associated with given key!");
+        }
+
+        if (size_ == this->getMaxSize())
+        {
+            this->rehash(2 * this->getCapacity());
+        }
+        this->place(ItemType{ key, std::move(data) });
+        ++size_;
+    }
+
+    template <typename K, typename T>
+    bool RobinHoodHashTable<K, T>::tryFind(const K& key, T*& data) const
+    {
+        const size_t index = this->findIndex(key, this->calculateHomeIndex(key));
+        if (index == INVALID_INDEX)
+        {
+            return false;
+        }
+        data = &slots_[index].data_;
+        return true;
+    }
+
+    template <typename K, typename T>
+    T RobinHoodHashTable<K, T>::remove(const K& key)
+    {
+        size_t index = this->findIndex(key, this->calculateHomeIndex(key));
+        if (index == INVALID_INDEX)
+        {
+            throw std::out_of_range("No such key!");
+        }
+
+        T result = std::move(slots_[index].data_);
+        slots_[index].~ItemType();
+
+        // Backward shift: displaced followers move one slot closer to their home.
+        size_t next = (index + 1) & mask_;
+        while (distances_[next] > 1)
+        {
+            new (slots_ + index) ItemType{ std::move(slots_[next]) };
+            slots_[next].~ItemType();
+            distances_[index] = distances_[next] - 1;
+            index = next;
+            next = (next + 1) & mask_;
+        }
+        distances_[index] = EMPTY;
+        --size_;
+        return result;
+    }
+
+    template <typename K, typename T>
+    size_t RobinHoodHashTable<K, T>::tryFindBatch(const K* keys, size_t count, T** data) const
+    {
+        size_t found = 0;
+        size_t homeIndices[BATCH_SIZE];
+        for (size_t first = 0; first < count; first += BATCH_SIZE)
+        {
+            const size_t batchSize = std::min(BATCH_SIZE, count - first);
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                homeIndices[i] = this->calculateHomeIndex(keys[first + i]);
+                simd::prefetch(distances_.get() + homeIndices[i]);
+                simd::prefetch(slots_ + homeIndices[i]);
+            }
+
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                const size_t index = this->findIndex(keys[first + i], homeIndices[i]);
+                data[first + i] = index != INVALID_INDEX ? &slots_[index].data_ : nullptr;
+                found += index != INVALID_INDEX ? 1 : 0;
+            }
+        }
+        return found;
+    }
+
+    template <typename K, typename T>
+    void RobinHoodHashTable<K, T>::reserve(size_t size)
+    {
+        const size_t capacity = calculateCapacity(size);
+        if (capacity > this->getCapacity())
+        {
+            this->rehash(capacity);
+        }
+    }
+
+    template <typename K, typename T>
+    size_t RobinHoodHashTable<K, T>::getCapacity() const
+    {
+        return mask_ + 1;
+    }
+
+    template <typename K, typename T>
+    double RobinHoodHashTable<K, T>::getLoadFactor() const
+    {
+        return static_cast<double>(size_) / this->getCapacity();
+    }
+
+    template <typename K, typename T>
+    auto RobinHoodHashTable<K, T>::getProbeLengthStatistics() const -> ProbeLengthStatistics
+    {
+        ProbeLengthStatistics statistics{ 0, 0.0, 0.0 };
+        if (size_ == 0)
+        {
+            return statistics;
+        }
+
+        double sum = 0.0;
+        double sumOfSquares = 0.0;
+        const size_t capacity = this->getCapacity();
+        for (size_t index = 0; index < capacity; ++index)
+        {
+            if (distances_[index] != EMPTY)
+            {
+                const size_t length = distances_[index] - 1;
+                statistics.max_ = std::max(statistics.max_, length);
+                sum += static_cast<double>(length);
+                sumOfSquares += static_cast<double>(length) * length;
+            }
+        }
+        statistics.mean_ = sum / size_;
+        statistics.variance_ = sumOfSquares / size_ - statistics.mean_ * statistics.mean_;
+        return statistics;
+    }
+
+    template <typename K, typename T>
+    size_t RobinHoodHashTable<K, T>::calculateHomeIndex(const K& key) const
+    {
+        return details::mixHash(hashFunction_(key)) & mask_;
+    }
+
+    template <typename K, typename T>
+    size_t RobinHoodHashTable<K, T>::findIndex(const K& key, size_t homeIndex) const
+    {
+        size_t index = homeIndex;
+        for (std::uint32_t distance = 1; distances_[index] >= distance; ++distance)
+        {
+            if (slots_[index].key_ == key)
+            {
+                return index;
+            }
+            index = (index + 1) & mask_;
+        }
+        return INVALID_INDEX;
+    }
+
+    template <typename K, typename T>
+    void RobinHoodHashTable<K, T>::place(ItemType&& item)
+    {
+        size_t index = this->calculateHomeIndex(item.key_);
+        std::uint32_t distance = 1;
+        while (distances_[index] != EMPTY)
+        {
+            if (distances_[index] < distance)
+            {
+                // The resident is closer to its home, it continues instead of the placed item.
+                using std::swap;
+                swap(slots_[index], item);
+                std::swap(distances_[index], distance);
+            }
+            index = (index + 1) & mask_;
+            ++distance;
+        }
+        new (slots_ + index) ItemType{ std::move(item) };
+        distances_[index] = distance;
+    }
+
+    template <typename K, typename T>
+    size_t RobinHoodHashTable<K, T>::getMaxSize() const
+    {
+        const size_t capacity = this->getCapacity();
+        return capacity - capacity / 8;
+    }
+
+    template <typename K, typename T>
+    void RobinHoodHashTable<K, T>::rehash(size_t capacity)
+    {
+        std::unique_ptr<std::uint32_t[]> oldDistances = std::move(distances_);
+        ItemType* oldSlots = slots_;
+        const size_t oldCapacity = this->getCapacity();
+        const size_t oldSize = size_;
+        this->allocate(capacity);
+
+        for (size_t oldIndex = 0; oldIndex < oldCapacity; ++oldIndex)
+        {
+            if (oldDistances[oldIndex] != EMPTY)
+            {
+                this->place(std::move(oldSlots[oldIndex]));
+                oldSlots[oldIndex].~ItemType();
+            }
+        }
+        std::allocator<ItemType>().deallocate(oldSlots, oldCapacity);
+        size_ = oldSize;
+    }
+
+    template <typename K, typename T>
+    void RobinHoodHashTable<K, T>::allocate(size_t capacity)
+    {
+        distances_ = std::make_unique<std::uint32_t[]>(capacity);
+        slots_ = std::allocator<ItemType>().allocate(capacity);
+        mask_ = capacity - 1;
+        size_ = 0;
+    }
+
+    template <typename K, typename T>
+    void RobinHoodHashTable<K, T>::destroyItems()
+    {
+        const size_t capacity = this->getCapacity();
+        for (size_t index = 0; index < capacity; ++index)
+        {
+            if (distances_[index] != EMPTY)
+            {
+                slots_[index].~ItemType();
+            }
+        }
+    }
+
+    template <typename K, typename T>
+    void RobinHoodHashTable<K, T>::deallocate()
+    {
+        std::allocator<ItemType>().deallocate(slots_, this->getCapacity());
+        slots_ = nullptr;
+        distances_.reset();
+    }
+
+    template <typename K, typename T>
+    size_t RobinHoodHashTable<K, T>::calculateCapacity(size_t size)
+    {
+        size_t capacity = 1;
+        while (capacity - capacity / 8 < size)
+        {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    //----------
+
+    template <typename K, typename T>
+    RobinHoodHashTable<K, T>::RobinHoodHashTableIterator::RobinHoodHashTableIterator(const RobinHoodHashTable* table, size_t index) :
+        table_(table),
+        index_(index)
+    {
+        this->skipEmptySlots();
+    }
+
+    template <typename K, typename T>
+    typename RobinHoodHashTable<K, T>::RobinHoodHashTableIterator& RobinHoodHashTable<K, T>::RobinHoodHashTableIterator::operator++()
+    {
+        ++index_;
+        this->skipEmptySlots();
+        return *this;
+    }
+
+    template <typename K, typename T>
+    typename RobinHoodHashTable<K, T>::RobinHoodHashTableIterator RobinHoodHashTable<K, T>::RobinHoodHashTableIterator::operator++(int)
+    {
+        RobinHoodHashTableIterator tmp(*this);
+        this->operator++();
+        return tmp;
+    }
+
+    template <typename K, typename T>
+    bool RobinHoodHashTable<K, T>::RobinHoodHashTableIterator::operator==(const RobinHoodHashTableIterator& other) const
+    {
+        return table_ == other.table_ && index_ == other.index_;
+    }
+
+    template <typename K, typename T>
+    bool RobinHoodHashTable<K, T>::RobinHoodHashTableIterator::operator!=(const RobinHoodHashTableIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    template <typename K, typename T>
+    TableItem<K, T>& RobinHoodHashTable<K, T>::RobinHoodHashTableIterator::operator*()
+    {
+        return table_->slots_[index_];
+    }
+
+    template <typename K, typename T>
+    void RobinHoodHashTable<K, T>::RobinHoodHashTableIterator::skipEmptySlots()
+    {
+        const size_t capacity = table_->getCapacity();
+        while (index_ < capacity && table_->distances_[index_] == EMPTY)
+        {
+            ++index_;
+        }
+    }
+
+    template <typename K, typename T>
+    typename RobinHoodHashTable<K, T>::RobinHoodHashTableIterator RobinHoodHashTable<K, T>::begin() const
+    {
+        return RobinHoodHashTableIterator(this, 0);
+    }
+
+    template <typename K, typename T>
+    typename RobinHoodHashTable<K, T>::RobinHoodHashTableIterator RobinHoodHashTable<K, T>::end() const
+    {
+        return RobinHoodHashTableIterator(this, this->getCapacity());
+    }
+}
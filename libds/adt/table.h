@@ -3,12 +3,71 @@
 #include <libds/adt/abstract_data_type.h>
 #include <libds/amt/implicit_sequence.h>
 #include <libds/amt/explicit_hierarchy.h>
+#include <libds/mm/pool_memory_manager.h>
+#include <libds/simd.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <limits>
 #include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace ds::adt {
 
+    namespace details
+    {
+        /**
+         * @brief Finalizer of MurmurHash3, every bit of @p hash affects every bit of the result.
+         * Hash tables with power-of-two sizes mix the hash before taking some of its bits.
+         */
+        inline size_t mixHash(size_t hash)
+        {
+            std::uint64_t mixed = hash;
+            mixed ^= mixed >> 33;
+            mixed *= 0xff51afd7ed558ccdULL;
+            mixed ^= mixed >> 33;
+            mixed *= 0xc4ceb9fe1a85ec53ULL;
+            mixed ^= mixed >> 33;
+            return static_cast<size_t>(mixed);
+        }
+
+        /**
+         * @brief Type the hash function of a hash table takes. Strings are hashed as string_view,
+         * so both std::string keys and views of them hash without allocating.
+         */
+        template <typename K>
+        struct HashKey
+        {
+            using type = K;
+        };
+
+        template <>
+        struct HashKey<std::string>
+        {
+            using type = std::string_view;
+        };
+
+        template <typename K>
+        using HashKeyType = typename HashKey<K>::type;
+
+        /**
+         * @brief Whether @p KeyType can be looked up in a table with keys @p K without creating a @p K.
+         */
+        template <typename K, typename KeyType>
+        inline constexpr bool isTransparentKey =
+            !std::is_same_v<K, HashKeyType<K>> &&
+            !std::is_same_v<K, KeyType> &&
+            std::is_convertible_v<const KeyType&, HashKeyType<K>>;
+    }
+
+    //----------
+
     template <typename K, typename T>
     struct TableItem
     {
@@ -46,6 +105,26 @@ namespace ds::adt {
 
     //----------
 
+    /**
+     * @brief Items of an ordered table from @p first up to, but not including, @p last,
+     * which can be visited by a range-based for.
+     */
+    template <typename IteratorType>
+    class TableRange
+    {
+    public:
+        TableRange(IteratorType first, IteratorType last);
+
+        IteratorType begin() const;
+        IteratorType end() const;
+
+    private:
+        IteratorType first_;
+        IteratorType last_;
+    };
+
+    //----------
+
     template <typename K, typename T, typename SequenceType>
     class SequenceTable :
         public Table<K, T>,
@@ -125,22 +204,82 @@ namespace ds::adt {
 
     //----------
 
+    template <typename K, typename T>
+    class FrozenSortedTable;
+
     template <typename K, typename T>
     class SortedSequenceTable :
         public SequenceTable<K, T, amt::IS<TableItem<K, T>>>
     {
+        friend class FrozenSortedTable<K, T>;
+
     public:
         void insert(const K& key, T data) override;
         T remove(const K& key) override;
         bool equals(const ADT& other) override;
 
+        /**
+         * @brief Replaces the items of the table by the TableItems in [@p first, @p last). They are
+         * sorted once and only the first of the items with equal keys is kept, which takes
+         * O(n log n) instead of the O(n^2) of inserting them one by one.
+         */
+        template <typename InputIterator>
+        void buildFromRange(InputIterator first, InputIterator last);
+
+        /**
+         * @brief Items lie next to each other in key order, so positions are pointers into the
+         * buffer and ranges are contiguous spans. Inserts and removes invalidate them.
+         */
+        using RangeIteratorType = TableItem<K, T>*;
+        using RangeType = TableRange<RangeIteratorType>;
+
+        /**
+         * @brief Position of the first item whose key isn't less than (lowerBound) or is greater
+         * than (upperBound) @p key, the end of the items if there is none. O(log n).
+         */
+        RangeIteratorType lowerBound(const K& key);
+        RangeIteratorType upperBound(const K& key);
+
+        /**
+         * @brief Items with @p key, i.e. at most one item.
+         */
+        RangeType equalRange(const K& key);
+
+        /**
+         * @brief Items whose keys lie in [@p from, @p to), found in O(log n). Empty if @p to isn't greater than @p from.
+         */
+        RangeType range(const K& from, const K& to);
+
     protected:
         using BlockType = typename amt::IS<TableItem<K, T>>::BlockType;
 
         BlockType* findBlockWithKey(const K& key) const override;
 
     private:
-        bool tryFindBlockWithKey(const K& key, size_t firstIndex, size_t lastIndex, BlockType*& lastBlock) const;
+        /**
+         * @brief Index of the first item whose key isn't less than @p key.
+         */
+        size_t lowerBoundIndex(const K& key) const;
+
+        /**
+         * @brief Index of the first item whose key is greater than @p key.
+         */
+        size_t upperBoundIndex(const K& key) const;
+
+        /**
+         * @brief Index of the first item whose key doesn't satisfy @p precedes, which holds for a
+         * prefix of the items. The binary search reads the contiguous buffer directly, selects
+         * the half without a branch and prefetches the middles of both possible next halves.
+         */
+        template <typename Predicate>
+        size_t partitionPoint(Predicate precedes) const;
+
+        /**
+         * @brief Position of the first item, nullptr if the table is empty.
+         */
+        RangeIteratorType accessItems();
+
+        static_assert(sizeof(BlockType) == sizeof(TableItem<K, T>), "Items of the buffer must be contiguous.");
     };
 
     template <typename K, typename T>
@@ -148,13 +287,75 @@ namespace ds::adt {
 
     //----------
 
+    /**
+     * @brief Read-only snapshot of a sorted sequence table stored in the Eytzinger order.
+     *
+     * The items form an implicit complete binary search tree laid out level by level, the sons
+     * of the item i are the items 2i + 1 and 2i + 2. A lookup descends from the root without
+     * branching on the comparison, and the first levels lie next to each other, so they stay in
+     * cache. The items of the level four steps ahead are prefetched. Iteration visits the items
+     * in the Eytzinger order, not sorted. Items can't be inserted or removed, only their data
+     * can be modified.
+     */
+    template <typename K, typename T>
+    class FrozenSortedTable :
+        public Table<K, T>,
+        public ADS<TableItem<K, T>>
+    {
+    public:
+        using IteratorType = typename amt::IS<TableItem<K, T>>::IteratorType;
+
+    public:
+        FrozenSortedTable();
+        FrozenSortedTable(const FrozenSortedTable& other);
+        explicit FrozenSortedTable(const SortedSequenceTable<K, T>& table);
+
+        bool equals(const ADT& other) override;
+
+        void insert(const K& key, T data) override; // throw(unavailable_function_call)
+        bool tryFind(const K& key, T*& data) const override;
+        T remove(const K& key) override; // throw(unavailable_function_call)
+
+        IteratorType begin();
+        IteratorType end();
+
+    private:
+        using BlockType = typename amt::IS<TableItem<K, T>>::BlockType;
+
+        static constexpr size_t PREFETCH_LEVELS = 4;
+
+        amt::IS<TableItem<K, T>>* getSequence() const;
+
+        /**
+         * @brief Stores the sorted @p items from @p itemIndex on in the subtree of the 1-based
+         * tree index @p treeIndex in order. Returns the index of the first item not stored.
+         */
+        size_t build(const amt::IS<TableItem<K, T>>& items, size_t itemIndex, size_t treeIndex);
+    };
+
+    //----------
+
+    /**
+     * @brief Item of a hash table, which keeps the mixed hash of its key so that rehashing
+     * doesn't call the hash function and lookups compare keys only when the hashes match.
+     */
+    template <typename K, typename T>
+    struct HashTableItem :
+        public TableItem<K, T>
+    {
+        size_t hash_;
+    };
+
     template <typename K, typename T>
     class HashTable :
         public Table<K, T>,
         public AUMS<TableItem<K, T>>
     {
     public:
-        using HashFunctionType = std::function<size_t(const K&)>;
+        /**
+         * @brief The hash function takes a string_view for std::string keys, see details::HashKey.
+         */
+        using HashFunctionType = std::function<size_t(const details::HashKeyType<K>&)>;
 
     public:
         HashTable();
@@ -172,26 +373,130 @@ namespace ds::adt {
         bool tryFind(const K& key, T*& data) const override;
         T remove(const K& key) override;
 
+        /**
+         * @brief Transparent lookups, which find a std::string key by a string_view or a C string
+         * without constructing a std::string.
+         */
+        template <typename KeyType, typename = std::enable_if_t<details::isTransparentKey<K, KeyType>>>
+        bool tryFind(const KeyType& key, T*& data) const;
+        template <typename KeyType, typename = std::enable_if_t<details::isTransparentKey<K, KeyType>>>
+        T& find(const KeyType& key);
+        template <typename KeyType, typename = std::enable_if_t<details::isTransparentKey<K, KeyType>>>
+        bool contains(const KeyType& key) const;
+
+        using Table<K, T>::find;
+        using Table<K, T>::contains;
+
+        /**
+         * @brief Looks up the @p count keys at @p keys and sets data[i] to the data of keys[i], or to
+         * nullptr if there is no such key. Returns the number of keys found. The keys are processed
+         * BATCH_SIZE at a time: all of them are hashed first and each step of their bucket and chain
+         * accesses is prefetched for the whole batch, so the cache misses of the keys overlap.
+         * The batch doesn't migrate buckets of an incremental rehash, so data set for earlier
+         * keys stays valid while the later ones are looked up.
+         */
+        size_t tryFindBatch(const K* keys, size_t count, T** data) const;
+
+        /**
+         * @brief Grows the primary region so that @p size elements fit without exceeding MAX_LOAD_FACTOR.
+         * The table doesn't shrink below this bucket count afterwards.
+         */
+        void reserve(size_t size);
+
+        size_t getBucketCount() const;
+        double getLoadFactor() const;
+
+        /**
+         * @brief In incremental mode a resize keeps the old primary region next to the new one and
+         * each insert and remove moves the next REHASH_STEP buckets to the new region, instead of
+         * moving all of them at once. Lookups only read, so data they return stays valid until the
+         * next modification. Turning the mode off finishes a pending migration.
+         */
+        void setIncrementalRehash(bool incremental);
+        bool isIncrementalRehash() const;
+
+        /**
+         * @brief Whether buckets of an incremental resize are still waiting in the old primary region.
+         */
+        bool isRehashing() const;
+
+        /**
+         * @brief The bucket count doubles when an insert exceeds MAX_LOAD_FACTOR and halves when
+         * a remove drops below MIN_LOAD_FACTOR, but never below the initial or reserved count.
+         */
+        static constexpr double MAX_LOAD_FACTOR = 1.0;
+        static constexpr double MIN_LOAD_FACTOR = 0.25;
+        static const size_t REHASH_STEP = 8;
+        static constexpr size_t BATCH_SIZE = 16;
+
     private:
-        using SynonymTable = UnsortedESTab<K, T>;
+        using SynonymTable = amt::SinglyLS<HashTableItem<K, T>>;
+        using SynonymBlockType = typename SynonymTable::BlockType;
         using SynonymTableIterator = typename SynonymTable::IteratorType;
-        using PrimaryRegionIterator = typename amt::IS<SynonymTable*>::IteratorType;
+        using BucketBlockType = typename amt::IS<SynonymTable*>::BlockType;
 
     private:
-        static const size_t CAPACITY = 100;
+        static const size_t CAPACITY = 128;
+
+        /**
+         * @brief Mixed hash of @p key. Bucket counts are powers of two, so the hash is mixed
+         * first and then masked, which keeps keys differing only in high bits apart.
+         */
+        size_t calculateHash(const details::HashKeyType<K>& key) const;
+
+        /**
+         * @brief Bucket block which holds or would hold a key with the mixed @p hash, in the old
+         * primary region if its bucket there hasn't been migrated yet.
+         */
+        BucketBlockType* accessBucket(size_t hash) const;
+
+        /**
+         * @brief Block of @p synonyms holding @p key, nullptr if there is none. Keys are compared
+         * only in blocks storing the same @p hash. @p previous is set to the preceding block.
+         */
+        static SynonymBlockType* findSynonym(SynonymTable* synonyms, const details::HashKeyType<K>& key, size_t hash,
+            SynonymBlockType*& previous);
+
+        bool tryFindKey(const details::HashKeyType<K>& key, T*& data) const;
+
+        /**
+         * @brief Replaces the primary region by one with @p bucketCount buckets. The buckets
+         * are moved right away, or gradually by migrateBuckets in incremental mode.
+         */
+        void rehash(size_t bucketCount);
+
+        /**
+         * @brief Moves up to @p count buckets of the old primary region to the new one and
+         * releases the old region after its last bucket.
+         */
+        void migrateBuckets(size_t count);
+        void finishRehash();
+
+        static size_t roundUpToPowerOfTwo(size_t count);
 
     private:
         amt::IS<SynonymTable*>* primaryRegion_;
         HashFunctionType hashFunction_;
         size_t size_;
+        size_t mask_;
+        size_t minimumBucketCount_;
+        bool incrementalRehash_;
+        amt::IS<SynonymTable*>* oldRegion_;
+        size_t oldMask_;
+        size_t migratedBuckets_;
 
     public:
+        /**
+         * @brief Iterator holding the bucket index and the position in its synonym table by value,
+         * so neither creating, copying nor advancing it allocates. Buckets are read directly from
+         * the contiguous blocks of the primary region. During an incremental rehash the buckets
+         * left in the old region are visited first, then it continues with @p nextBuckets.
+         */
         class HashTableIterator
         {
         public:
-            HashTableIterator(PrimaryRegionIterator* tablesFirst, PrimaryRegionIterator* tablesLast);
-            HashTableIterator(const HashTableIterator& other);
-            ~HashTableIterator();
+            HashTableIterator(BucketBlockType* buckets, size_t bucketCount, size_t bucketIndex,
+                BucketBlockType* nextBuckets, size_t nextBucketCount);
             HashTableIterator& operator++();
             HashTableIterator operator++(int);
             bool operator==(const HashTableIterator& other) const;
@@ -199,9 +504,19 @@ namespace ds::adt {
             TableItem<K, T>& operator*();
 
         private:
-            PrimaryRegionIterator* tablesCurrent_;
-            PrimaryRegionIterator* tablesLast_;
-            SynonymTableIterator* synonymIterator_;
+            /**
+             * @brief Moves to the first item of the first non-empty bucket from bucketIndex_ on,
+             * or to the end if there is none.
+             */
+            void enterNonEmptyBucket();
+
+        private:
+            BucketBlockType* buckets_;
+            size_t bucketCount_;
+            size_t bucketIndex_;
+            BucketBlockType* nextBuckets_;
+            size_t nextBucketCount_;
+            SynonymTableIterator synonymIterator_;
         };
 
         HashTableIterator begin() const;
@@ -224,6 +539,11 @@ namespace ds::adt {
         ~GeneralBinarySearchTree() override;
 
         size_t size() const override;
+
+        /**
+         * @brief O(1), unlike the node count of the hierarchy.
+         */
+        bool isEmpty() const override;
         void clear() override;
 
         void insert(const K& key, T data) override;
@@ -236,11 +556,63 @@ namespace ds::adt {
     protected:
         using BSTNodeType = typename amt::BinaryEH<ItemType>::BlockType;
 
+    public:
+        /**
+         * @brief In-order iterator holding just its node, which moves to the in-order successor
+         * through the parent links. Visiting k items from a node takes O(h + k) without allocating.
+         */
+        class RangeIterator
+        {
+        public:
+            explicit RangeIterator(BSTNodeType* node);
+            RangeIterator& operator++();
+            RangeIterator operator++(int);
+            bool operator==(const RangeIterator& other) const;
+            bool operator!=(const RangeIterator& other) const;
+            ItemType& operator*();
+
+        private:
+            BSTNodeType* node_;
+        };
+
+        using RangeType = TableRange<RangeIterator>;
+
+        /**
+         * @brief Position of the first item whose key isn't less than (lowerBound) or is greater
+         * than (upperBound) @p key, the end if there is none. O(h) for a tree of height h.
+         */
+        RangeIterator lowerBound(const K& key) const;
+        RangeIterator upperBound(const K& key) const;
+
+        /**
+         * @brief Items with @p key, i.e. at most one item.
+         */
+        RangeType equalRange(const K& key) const;
+
+        /**
+         * @brief Items whose keys lie in [@p from, @p to), found in O(h). Empty if @p to isn't greater than @p from.
+         */
+        RangeType range(const K& from, const K& to) const;
+
+    protected:
+        /**
+         * @brief Creates a tree stored in @p hierarchy, which it takes ownership of.
+         */
+        explicit GeneralBinarySearchTree(amt::BinaryEH<ItemType>* hierarchy);
+        GeneralBinarySearchTree(amt::BinaryEH<ItemType>* hierarchy, const GeneralBinarySearchTree& other);
+
         amt::BinaryEH<ItemType>* getHierarchy() const;
 
         virtual void removeNode(BSTNodeType* node);
         virtual void balanceTree(BSTNodeType* node) { }
 
+        /**
+         * @brief Removes @p node without balancing the tree. A node with two sons takes the key and data
+         * of its in-order successor, whose node is released instead.
+         * @return Parent of the released node, nullptr if it was the root.
+         */
+        BSTNodeType* unlinkNode(BSTNodeType* node);
+
         bool tryFindNodeWithKey(const K& key, BSTNodeType*& node) const;
 
         void rotateLeft(BSTNodeType* node);
@@ -289,6 +661,65 @@ namespace ds::adt {
 
     //----------
 
+    template <typename K, typename T>
+    struct AVLTreeItem :
+        public TableItem<K, T>
+    {
+        size_t height_;
+        size_t subtreeSize_;
+    };
+
+    /**
+     * @brief Binary search tree kept balanced by AVL rotations, so that its height stays below 1.44 log n
+     * even if the keys come in sorted order.
+     *
+     * Every node knows the size of its subtree, which gives the rank of a key and the item of a given
+     * rank in O(log n). Nodes are allocated from a PoolMemoryManager.
+     */
+    template <typename K, typename T>
+    class AVLTree :
+        public GeneralBinarySearchTree<K, T, AVLTreeItem<K, T>>
+    {
+    public:
+        AVLTree();
+        AVLTree(const AVLTree& other);
+
+        size_t size() const override;
+        bool equals(const ADT& other) override;
+
+        /**
+         * @brief Number of keys less than @p key, whether the table contains @p key or not.
+         */
+        size_t rank(const K& key) const;
+
+        /**
+         * @brief Item with the @p index-th smallest key. Throws std::out_of_range if there is no such item.
+         */
+        TableItem<K, T>& select(size_t index) const;
+
+    protected:
+        using BSTNodeType = typename GeneralBinarySearchTree<K, T, AVLTreeItem<K, T>>::BSTNodeType;
+
+        void removeNode(BSTNodeType* node) override;
+        void balanceTree(BSTNodeType* node) override;
+
+    private:
+        using BaseType = GeneralBinarySearchTree<K, T, AVLTreeItem<K, T>>;
+        using HierarchyType = amt::BinaryEH<AVLTreeItem<K, T>>;
+
+        static size_t height(const BSTNodeType* node);
+        static size_t subtreeSize(const BSTNodeType* node);
+        static std::ptrdiff_t balanceOf(const BSTNodeType* node);
+        static void updateNode(BSTNodeType* node);
+
+        /**
+         * @brief Restores the heights and sizes on the path from @p node to the root, rotating where they differ by two.
+         */
+        void rebalance(BSTNodeType* node);
+    };
+
+    //----------
+
     template<typename K, typename T>
     template<class TableT>
     bool Table<K, T>::areEqual(TableT& table1, const ADT& table2)
@@ -342,6 +773,27 @@ namespace ds::adt {
 
     //----------
 
+    template <typename IteratorType>
+    TableRange<IteratorType>::TableRange(IteratorType first, IteratorType last) :
+        first_(first),
+        last_(last)
+    {
+    }
+
+    template <typename IteratorType>
+    IteratorType TableRange<IteratorType>::begin() const
+    {
+        return first_;
+    }
+
+    template <typename IteratorType>
+    IteratorType TableRange<IteratorType>::end() const
+    {
+        return last_;
+    }
+
+    //----------
+
     template<typename K, typename T, typename SequenceType>
     SequenceTable<K, T, SequenceType>::SequenceTable() :
         ADS<TableItem<K, T>>(new SequenceType())
@@ -389,6 +841,18 @@ namespace ds::adt {
     template<typename K, typename T, typename SequenceType>
     typename UnsortedSequenceTable<K, T, SequenceType>::BlockType* UnsortedSequenceTable<K, T, SequenceType>::findBlockWithKey(const K& key) const
     {
+        if constexpr (std::is_base_of_v<amt::IS<TableItem<K, T>>, SequenceType>)
+        {
+            // Keys lie in the contiguous buffer one block apart.
+            SequenceType* sequence = this->getSequence();
+            if (sequence->isEmpty())
+            {
+                return nullptr;
+            }
+            const size_t index = simd::findStrided(&sequence->peek(0)->data_.key_, sizeof(BlockType), sequence->size(), key);
+            return index != INVALID_INDEX ? sequence->access(index) : nullptr;
+        }
+
         return this->getSequence()->findBlockWithProperty([&key](BlockType* b) ->bool
             {
                 return b->data_.key_ == key;
@@ -405,9 +869,7 @@ namespace ds::adt {
             throw std::logic_error("Table already contains element associated with given key!");
         }
 
-        TableItem<K, T>& tableItem = this->getSequence()->insertLast().data_;
-        tableItem.key_ = key;
-        tableItem.data_ = data;
+        this->getSequence()->emplaceLast(key, std::move(data));
     }
 
     template<typename K, typename T>
@@ -446,9 +908,7 @@ namespace ds::adt {
             throw std::logic_error("Table already contains element associated with given key!");
         }
 
-        TableItem<K, T>& tableItem = this->getSequence()->insertFirst().data_;
-        tableItem.key_ = key;
-        tableItem.data_ = data;
+        this->getSequence()->emplaceFirst(key, std::move(data));
     }
 
     template<typename K, typename T>
@@ -483,102 +943,256 @@ namespace ds::adt {
     template<typename K, typename T>
     void SortedSequenceTable<K, T>::insert(const K& key, T data)
     {
-        TableItem<K, T>* tableItem;
-
-        if (this->isEmpty())
+        const size_t index = this->lowerBoundIndex(key);
+        if (index < this->size() && this->getSequence()->peek(index)->data_.key_ == key)
         {
-            tableItem = &this->getSequence()->insertFirst().data_;
+            throw std::logic_error("Duplicate key!");
         }
-        else
+        this->getSequence()->emplaceAt(index, key, std::move(data));
+    }
+
+    template<typename K, typename T>
+    T SortedSequenceTable<K, T>::remove(const K& key)
+    {
+        const size_t index = this->lowerBoundIndex(key);
+        if (index == this->size() || !(this->getSequence()->peek(index)->data_.key_ == key))
         {
-            BlockType* blok = nullptr;
-            if (this->tryFindBlockWithKey(key, 0, this->size(), blok))
-            {
-                throw std::logic_error("Duplicate key!");
-            }
-            tableItem = key > blok->data_.key_
-                ? &this->getSequence()->insertAfter(*blok).data_
-                : &this->getSequence()->insertBefore(*blok).data_;
+            throw std::out_of_range("No such key!");
         }
 
-        tableItem->key_ = key;
-        tableItem->data_ = data;
+        T result = this->getSequence()->peek(index)->data_.data_;
+        this->getSequence()->remove(index);
+        return result;
     }
 
     template<typename K, typename T>
-    T SortedSequenceTable<K, T>::remove(const K& key)
+    typename SortedSequenceTable<K, T>::BlockType* SortedSequenceTable<K, T>::findBlockWithKey(const K& key) const
+    {
+        const size_t index = this->lowerBoundIndex(key);
+        return index < this->size() && this->getSequence()->peek(index)->data_.key_ == key
+            ? this->getSequence()->access(index)
+            : nullptr;
+    }
+
+    template<typename K, typename T>
+    bool SortedSequenceTable<K, T>::equals(const ADT& other)
+    {
+        return Table<K, T>::areEqual(*this, other);
+    }
+
+    template<typename K, typename T>
+    template<typename InputIterator>
+    void SortedSequenceTable<K, T>::buildFromRange(InputIterator first, InputIterator last)
     {
-        BlockType* blockWithKey = nullptr;
-        if (!this->tryFindBlockWithKey(key, 0, this->size(), blockWithKey))
+        std::vector<TableItem<K, T>> items(first, last);
+        std::stable_sort(items.begin(), items.end(), [](const TableItem<K, T>& item1, const TableItem<K, T>& item2)
+            {
+                return item1.key_ < item2.key_;
+            });
+        const auto uniqueEnd = std::unique(items.begin(), items.end(), [](const TableItem<K, T>& item1, const TableItem<K, T>& item2)
+            {
+                return item1.key_ == item2.key_;
+            });
+
+        amt::IS<TableItem<K, T>>* sequence = this->getSequence();
+        sequence->clear();
+        if (uniqueEnd != items.begin())
         {
-            throw std::out_of_range("No such key!");
+            sequence->reserveCapacity(static_cast<size_t>(uniqueEnd - items.begin()));
         }
+        for (auto item = items.begin(); item != uniqueEnd; ++item)
+        {
+            sequence->emplaceLast(std::move(item->key_), std::move(item->data_));
+        }
+    }
 
-        T result = blockWithKey->data_.data_;
-        if (this->getSequence()->accessFirst() == blockWithKey)
+    template<typename K, typename T>
+    auto SortedSequenceTable<K, T>::lowerBound(const K& key) -> RangeIteratorType
+    {
+        const size_t index = this->lowerBoundIndex(key);
+        return this->accessItems() + index;
+    }
+
+    template<typename K, typename T>
+    auto SortedSequenceTable<K, T>::upperBound(const K& key) -> RangeIteratorType
+    {
+        const size_t index = this->upperBoundIndex(key);
+        return this->accessItems() + index;
+    }
+
+    template<typename K, typename T>
+    auto SortedSequenceTable<K, T>::equalRange(const K& key) -> RangeType
+    {
+        const size_t first = this->lowerBoundIndex(key);
+        const size_t last = first < this->size() && this->getSequence()->peek(first)->data_.key_ == key
+            ? first + 1
+            : first;
+        RangeIteratorType items = this->accessItems();
+        return RangeType(items + first, items + last);
+    }
+
+    template<typename K, typename T>
+    auto SortedSequenceTable<K, T>::range(const K& from, const K& to) -> RangeType
+    {
+        const size_t first = this->lowerBoundIndex(from);
+        const size_t last = from < to ? this->lowerBoundIndex(to) : first;
+        RangeIteratorType items = this->accessItems();
+        return RangeType(items + first, items + last);
+    }
+
+    template<typename K, typename T>
+    size_t SortedSequenceTable<K, T>::lowerBoundIndex(const K& key) const
+    {
+        return this->partitionPoint([&key](const K& itemKey) { return itemKey < key; });
+    }
+
+    template<typename K, typename T>
+    size_t SortedSequenceTable<K, T>::upperBoundIndex(const K& key) const
+    {
+        return this->partitionPoint([&key](const K& itemKey) { return !(key < itemKey); });
+    }
+
+    template<typename K, typename T>
+    template<typename Predicate>
+    size_t SortedSequenceTable<K, T>::partitionPoint(Predicate precedes) const
+    {
+        size_t count = this->size();
+        if (count == 0)
         {
-            this->getSequence()->removeFirst();
+            return 0;
         }
-        else
+
+        const BlockType* const blocks = this->getSequence()->peek(0);
+        const BlockType* base = blocks;
+        while (count > 1)
         {
-            this->getSequence()->removeNext(*this->getSequence()->accessPrevious(*blockWithKey));
+            const size_t half = count / 2;
+            simd::prefetch(base + half / 2);
+            simd::prefetch(base + half + half / 2);
+            base = precedes(base[half].data_.key_) ? base + half : base;
+            count -= half;
         }
-        return result;
+        return static_cast<size_t>(base - blocks) + (precedes(base->data_.key_) ? 1 : 0);
     }
 
     template<typename K, typename T>
-    typename SortedSequenceTable<K, T>::BlockType* SortedSequenceTable<K, T>::findBlockWithKey(const K& key) const
+    auto SortedSequenceTable<K, T>::accessItems() -> RangeIteratorType
+    {
+        return this->isEmpty() ? nullptr : &this->getSequence()->access(0)->data_;
+    }
+
+    //----------
+
+    template<typename K, typename T>
+    FrozenSortedTable<K, T>::FrozenSortedTable() :
+        ADS<TableItem<K, T>>(new amt::IS<TableItem<K, T>>())
     {
-        BlockType* blockWithKey = nullptr;
-        return this->tryFindBlockWithKey(key, 0, this->size(), blockWithKey)
-            ? blockWithKey
-            : nullptr;
     }
 
     template<typename K, typename T>
-    bool SortedSequenceTable<K, T>::equals(const ADT& other)
+    FrozenSortedTable<K, T>::FrozenSortedTable(const FrozenSortedTable& other) :
+        ADS<TableItem<K, T>>(new amt::IS<TableItem<K, T>>(), other)
+    {
+    }
+
+    template<typename K, typename T>
+    FrozenSortedTable<K, T>::FrozenSortedTable(const SortedSequenceTable<K, T>& table) :
+        ADS<TableItem<K, T>>(new amt::IS<TableItem<K, T>>(table.size(), true))
+    {
+        this->build(*table.getSequence(), 0, 1);
+    }
+
+    template<typename K, typename T>
+    bool FrozenSortedTable<K, T>::equals(const ADT& other)
     {
         return Table<K, T>::areEqual(*this, other);
     }
 
     template<typename K, typename T>
-    bool SortedSequenceTable<K, T>::tryFindBlockWithKey(const K& key, size_t firstIndex, size_t lastIndex, BlockType*& lastBlock) const
+    void FrozenSortedTable<K, T>::insert(const K&, T)
     {
-        if (this->isEmpty())
+        throw amt::unavailable_function_call("Method insert() unavailable in frozen tables!");
+    }
+
+    template<typename K, typename T>
+    bool FrozenSortedTable<K, T>::tryFind(const K& key, T*& data) const
+    {
+        const size_t count = this->size();
+        if (count == 0)
         {
-            lastBlock = nullptr;
             return false;
         }
 
-        size_t midIndex = firstIndex;
-        while (firstIndex < lastIndex)
+        // 1-based tree index, the item of the tree index i is blocks[i - 1].
+        const BlockType* const blocks = this->getSequence()->peek(0);
+        size_t treeIndex = 1;
+        while (treeIndex <= count)
         {
-            midIndex = firstIndex + (lastIndex - firstIndex) / 2;
-            lastBlock = this->getSequence()->access(midIndex);
-
-            if (lastBlock->data_.key_ < key)
-            {
-                firstIndex = midIndex + 1;
-            }
-            else if (lastBlock->data_.key_ > key)
-            {
-                lastIndex = midIndex;
-            }
-            else
+            const size_t prefetchIndex = treeIndex << PREFETCH_LEVELS;
+            if (prefetchIndex <= count)
             {
-                break;
+                simd::prefetch(blocks + prefetchIndex - 1);
             }
+            treeIndex = 2 * treeIndex + (blocks[treeIndex - 1].data_.key_ < key ? 1 : 0);
+        }
+
+        // The descent went right after the lower bound and left ever since, undo those steps.
+        while ((treeIndex & 1) != 0)
+        {
+            treeIndex >>= 1;
+        }
+        treeIndex >>= 1;
+
+        if (treeIndex == 0 || !(blocks[treeIndex - 1].data_.key_ == key))
+        {
+            return false;
         }
+        data = &this->getSequence()->access(treeIndex - 1)->data_.data_;
+        return true;
+    }
+
+    template<typename K, typename T>
+    T FrozenSortedTable<K, T>::remove(const K&)
+    {
+        throw amt::unavailable_function_call("Method remove() unavailable in frozen tables!");
+    }
+
+    template<typename K, typename T>
+    typename FrozenSortedTable<K, T>::IteratorType FrozenSortedTable<K, T>::begin()
+    {
+        return this->getSequence()->begin();
+    }
+
+    template<typename K, typename T>
+    typename FrozenSortedTable<K, T>::IteratorType FrozenSortedTable<K, T>::end()
+    {
+        return this->getSequence()->end();
+    }
 
-        lastBlock = this->getSequence()->access(midIndex);
-        return lastBlock->data_.key_ == key;
+    template<typename K, typename T>
+    amt::IS<TableItem<K, T>>* FrozenSortedTable<K, T>::getSequence() const
+    {
+        return dynamic_cast<amt::IS<TableItem<K, T>>*>(this->memoryStructure_);
+    }
+
+    template<typename K, typename T>
+    size_t FrozenSortedTable<K, T>::build(const amt::IS<TableItem<K, T>>& items, size_t itemIndex, size_t treeIndex)
+    {
+        if (treeIndex <= items.size())
+        {
+            itemIndex = this->build(items, itemIndex, 2 * treeIndex);
+            this->getSequence()->access(treeIndex - 1)->data_ = items.peek(itemIndex)->data_;
+            ++itemIndex;
+            itemIndex = this->build(items, itemIndex, 2 * treeIndex + 1);
+        }
+        return itemIndex;
     }
 
     //----------
 
     template<typename K, typename T>
     HashTable<K, T>::HashTable() :
-        HashTable([](const K& key) { return std::hash<K>()(key); }, CAPACITY)
+        HashTable([](const details::HashKeyType<K>& key) { return std::hash<details::HashKeyType<K>>()(key); }, CAPACITY)
     {
     }
 
@@ -586,16 +1200,28 @@ namespace ds::adt {
     HashTable<K, T>::HashTable(const HashTable& other) :
         primaryRegion_(new amt::IS<SynonymTable*>(other.primaryRegion_->size(), true)),
         hashFunction_(other.hashFunction_),
-        size_(0)
+        size_(0),
+        mask_(other.mask_),
+        minimumBucketCount_(other.minimumBucketCount_),
+        incrementalRehash_(other.incrementalRehash_),
+        oldRegion_(nullptr),
+        oldMask_(0),
+        migratedBuckets_(0)
     {
         assign(other);
     }
 
     template<typename K, typename T>
     HashTable<K, T>::HashTable(HashFunctionType hashFunction, size_t capacity) :
-        primaryRegion_(new amt::IS<SynonymTable*>(capacity, true)),
+        primaryRegion_(new amt::IS<SynonymTable*>(roundUpToPowerOfTwo(capacity), true)),
         hashFunction_(hashFunction),
-        size_(0)
+        size_(0),
+        mask_(primaryRegion_->size() - 1),
+        minimumBucketCount_(primaryRegion_->size()),
+        incrementalRehash_(false),
+        oldRegion_(nullptr),
+        oldMask_(0),
+        migratedBuckets_(0)
     {
     }
 
@@ -657,6 +1283,16 @@ namespace ds::adt {
                 delete synonymBlock->data_;
                 synonymBlock->data_ = nullptr;
             });
+
+        if (oldRegion_ != nullptr)
+        {
+            oldRegion_->processAllBlocksForward([](typename amt::IS<SynonymTable*>::BlockType* synonymBlock)
+                {
+                    delete synonymBlock->data_;
+                });
+            delete oldRegion_;
+            oldRegion_ = nullptr;
+        }
     }
 
     template <typename K, typename T>
@@ -674,8 +1310,9 @@ namespace ds::adt {
     template <typename K, typename T>
     void HashTable<K, T>::insert(const K& key, T data)
     {
-        const size_t index = hashFunction_(key) % primaryRegion_->size();
-        auto* block = primaryRegion_->access(index);
+        this->migrateBuckets(REHASH_STEP);
+        const size_t hash = this->calculateHash(key);
+        auto* block = this->accessBucket(hash);
         SynonymTable* st = block->data_;
 
         if (st == nullptr) {
@@ -683,35 +1320,83 @@ namespace ds::adt {
             block->data_ = st;
         }
 
-        st->insert(key, std::move(data));
+        SynonymBlockType* previous = nullptr;
+        if (findSynonym(st, key, hash, previous) != nullptr)
+        {
+            throw std::logic_error("Table already contains element associated with given key!");
+        }
+
+        st->emplaceFirst(key, std::move(data), hash);
         ++size_;
+
+        const size_t bucketCount = this->getBucketCount();
+        if (!this->isRehashing() && size_ > MAX_LOAD_FACTOR * bucketCount)
+        {
+            this->rehash(2 * bucketCount);
+        }
     }
 
     template <typename K, typename T>
     bool HashTable<K, T>::tryFind(const K& key, T*& data) const
     {
-        const size_t index = hashFunction_(key) % primaryRegion_->size();
-        auto* bucketBlock = primaryRegion_->access(index);
-        SynonymTable* bucket = bucketBlock->data_;
+        return this->tryFindKey(key, data);
+    }
 
-        if (bucket == nullptr) {
-            return false;
+    template <typename K, typename T>
+    template <typename KeyType, typename>
+    bool HashTable<K, T>::tryFind(const KeyType& key, T*& data) const
+    {
+        return this->tryFindKey(key, data);
+    }
+
+    template <typename K, typename T>
+    template <typename KeyType, typename>
+    T& HashTable<K, T>::find(const KeyType& key)
+    {
+        T* data = nullptr;
+        if (!this->tryFindKey(key, data))
+        {
+            throw std::out_of_range("No such key!");
         }
-        return bucket->tryFind(key, data);
+        return *data;
+    }
+
+    template <typename K, typename T>
+    template <typename KeyType, typename>
+    bool HashTable<K, T>::contains(const KeyType& key) const
+    {
+        T* data = nullptr;
+        return this->tryFindKey(key, data);
     }
 
     template <typename K, typename T>
     T HashTable<K, T>::remove(const K& key)
     {
-        const size_t index = hashFunction_(key) % primaryRegion_->size();
-        auto* bucketBlock = primaryRegion_->access(index);
+        this->migrateBuckets(REHASH_STEP);
+        const size_t hash = this->calculateHash(key);
+        auto* bucketBlock = this->accessBucket(hash);
         SynonymTable* bucket = bucketBlock->data_;
 
         if (bucket == nullptr) {        // vôbec tu nič nie je
             throw std::out_of_range("No such key!");
         }
 
-        T result = bucket->remove(key);
+        SynonymBlockType* previous = nullptr;
+        SynonymBlockType* synonym = findSynonym(bucket, key, hash, previous);
+        if (synonym == nullptr)
+        {
+            throw std::out_of_range("No such key!");
+        }
+
+        T result = std::move(synonym->data_.data_);
+        if (previous == nullptr)
+        {
+            bucket->removeFirst();
+        }
+        else
+        {
+            bucket->removeNext(*previous);
+        }
         --size_;
 
         // Ak sme reťaz úplne vyprázdnili, zmažeme ju a v slote necháme nullptr
@@ -719,70 +1404,264 @@ namespace ds::adt {
             delete bucket;
             bucketBlock->data_ = nullptr;
         }
+
+        const size_t bucketCount = this->getBucketCount();
+        if (!this->isRehashing() && bucketCount > minimumBucketCount_ && size_ < MIN_LOAD_FACTOR * bucketCount)
+        {
+            this->rehash(bucketCount / 2);
+        }
         return result;
     }
 
     template <typename K, typename T>
-    HashTable<K, T>::HashTableIterator::HashTableIterator
-        (PrimaryRegionIterator* tablesFirst, PrimaryRegionIterator* tablesLast) :
-        tablesCurrent_(tablesFirst),
-        tablesLast_(tablesLast)
+    size_t HashTable<K, T>::tryFindBatch(const K* keys, size_t count, T** data) const
     {
-        while (*tablesCurrent_ != *tablesLast_ && **tablesCurrent_ == nullptr)
+        size_t found = 0;
+        size_t hashes[BATCH_SIZE];
+        SynonymTable* buckets[BATCH_SIZE];
+        for (size_t first = 0; first < count; first += BATCH_SIZE)
         {
-            ++(*tablesCurrent_);
+            const size_t batchSize = std::min(BATCH_SIZE, count - first);
+
+            BucketBlockType* bucketBlocks[BATCH_SIZE];
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                hashes[i] = this->calculateHash(keys[first + i]);
+                bucketBlocks[i] = this->accessBucket(hashes[i]);
+                simd::prefetch(bucketBlocks[i]);
+            }
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                buckets[i] = bucketBlocks[i]->data_;
+                if (buckets[i] != nullptr)
+                {
+                    simd::prefetch(buckets[i]);
+                }
+            }
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                if (buckets[i] != nullptr)
+                {
+                    simd::prefetch(buckets[i]->accessFirst());
+                }
+            }
+
+            for (size_t i = 0; i < batchSize; ++i)
+            {
+                SynonymBlockType* previous = nullptr;
+                SynonymBlockType* synonym = buckets[i] != nullptr
+                    ? findSynonym(buckets[i], keys[first + i], hashes[i], previous)
+                    : nullptr;
+                data[first + i] = synonym != nullptr ? &synonym->data_.data_ : nullptr;
+                found += synonym != nullptr ? 1 : 0;
+            }
         }
-        synonymIterator_ = *tablesCurrent_ != *tablesLast_
-            ? new SynonymTableIterator((**tablesCurrent_)->begin())
-            : nullptr;
+        return found;
     }
 
     template <typename K, typename T>
-    HashTable<K, T>::HashTableIterator::HashTableIterator
-        (const HashTableIterator& other) :
-        tablesCurrent_(new PrimaryRegionIterator(*other.tablesCurrent_)),
-        tablesLast_(new PrimaryRegionIterator(*other.tablesLast_)),
-        synonymIterator_(other.synonymIterator_ != nullptr
-            ? new SynonymTableIterator(*other.synonymIterator_)
-            : nullptr
-        )
+    void HashTable<K, T>::reserve(size_t size)
     {
+        const size_t bucketCount = roundUpToPowerOfTwo(static_cast<size_t>(std::ceil(size / MAX_LOAD_FACTOR)));
+        minimumBucketCount_ = std::max(minimumBucketCount_, bucketCount);
+        if (bucketCount > this->getBucketCount())
+        {
+            this->finishRehash();
+            this->rehash(bucketCount);
+        }
     }
 
     template <typename K, typename T>
-    HashTable<K, T>::HashTableIterator::~HashTableIterator()
+    size_t HashTable<K, T>::getBucketCount() const
     {
-        delete tablesCurrent_;
-        delete tablesLast_;
-        delete synonymIterator_;
+        return mask_ + 1;
     }
 
     template <typename K, typename T>
-    typename HashTable<K, T>::HashTableIterator& HashTable<K, T>::HashTableIterator::operator++()
+    double HashTable<K, T>::getLoadFactor() const
     {
-        if (synonymIterator_ == nullptr) {
-            return *this;
+        return static_cast<double>(size_) / this->getBucketCount();
+    }
+
+    template <typename K, typename T>
+    void HashTable<K, T>::setIncrementalRehash(bool incremental)
+    {
+        incrementalRehash_ = incremental;
+        if (!incremental)
+        {
+            this->finishRehash();
+        }
+    }
+
+    template <typename K, typename T>
+    bool HashTable<K, T>::isIncrementalRehash() const
+    {
+        return incrementalRehash_;
+    }
+
+    template <typename K, typename T>
+    bool HashTable<K, T>::isRehashing() const
+    {
+        return oldRegion_ != nullptr;
+    }
+
+    template <typename K, typename T>
+    size_t HashTable<K, T>::calculateHash(const details::HashKeyType<K>& key) const
+    {
+        return details::mixHash(hashFunction_(key));
+    }
+
+    template <typename K, typename T>
+    auto HashTable<K, T>::accessBucket(size_t hash) const -> BucketBlockType*
+    {
+        if (oldRegion_ != nullptr)
+        {
+            const size_t oldIndex = hash & oldMask_;
+            if (oldIndex >= migratedBuckets_)
+            {
+                return oldRegion_->access(oldIndex);
+            }
+        }
+        return primaryRegion_->access(hash & mask_);
+    }
+
+    template <typename K, typename T>
+    auto HashTable<K, T>::findSynonym(SynonymTable* synonyms, const details::HashKeyType<K>& key, size_t hash,
+        SynonymBlockType*& previous) -> SynonymBlockType*
+    {
+        previous = nullptr;
+        for (SynonymBlockType* block = synonyms->accessFirst(); block != nullptr; block = block->next_)
+        {
+            if (block->data_.hash_ == hash && block->data_.key_ == key)
+            {
+                return block;
+            }
+            previous = block;
+        }
+        return nullptr;
+    }
+
+    template <typename K, typename T>
+    bool HashTable<K, T>::tryFindKey(const details::HashKeyType<K>& key, T*& data) const
+    {
+        const size_t hash = this->calculateHash(key);
+        SynonymTable* bucket = this->accessBucket(hash)->data_;
+        if (bucket == nullptr)
+        {
+            return false;
+        }
+
+        SynonymBlockType* previous = nullptr;
+        SynonymBlockType* synonym = findSynonym(bucket, key, hash, previous);
+        if (synonym == nullptr)
+        {
+            return false;
+        }
+        data = &synonym->data_.data_;
+        return true;
+    }
+
+    template <typename K, typename T>
+    void HashTable<K, T>::rehash(size_t bucketCount)
+    {
+        oldRegion_ = primaryRegion_;
+        oldMask_ = mask_;
+        migratedBuckets_ = 0;
+        primaryRegion_ = new amt::IS<SynonymTable*>(bucketCount, true);
+        mask_ = bucketCount - 1;
+
+        if (!incrementalRehash_)
+        {
+            this->finishRehash();
+        }
+    }
+
+    template <typename K, typename T>
+    void HashTable<K, T>::migrateBuckets(size_t count)
+    {
+        if (oldRegion_ == nullptr)
+        {
+            return;
+        }
+
+        BucketBlockType* oldBuckets = oldRegion_->accessFirst();
+        BucketBlockType* newBuckets = primaryRegion_->accessFirst();
+        const size_t oldBucketCount = oldMask_ + 1;
+        const size_t last = std::min(oldBucketCount, migratedBuckets_ + count);
+        for (; migratedBuckets_ < last; ++migratedBuckets_)
+        {
+            SynonymTable* bucket = oldBuckets[migratedBuckets_].data_;
+            if (bucket == nullptr)
+            {
+                continue;
+            }
+
+            for (HashTableItem<K, T>& item : *bucket)
+            {
+                BucketBlockType& newBlock = newBuckets[item.hash_ & mask_];
+                if (newBlock.data_ == nullptr)
+                {
+                    newBlock.data_ = new SynonymTable();
+                }
+                newBlock.data_->emplaceFirst(std::move(item));
+            }
+            delete bucket;
+            oldBuckets[migratedBuckets_].data_ = nullptr;
+        }
+
+        if (migratedBuckets_ == oldBucketCount)
+        {
+            delete oldRegion_;
+            oldRegion_ = nullptr;
         }
+    }
 
-        ++(*synonymIterator_);                        
+    template <typename K, typename T>
+    void HashTable<K, T>::finishRehash()
+    {
+        if (oldRegion_ != nullptr)
+        {
+            this->migrateBuckets(oldMask_ + 1);
+        }
+    }
 
-        if (*synonymIterator_ != (**tablesCurrent_)->end()) {
-            return *this;                             
+    template <typename K, typename T>
+    size_t HashTable<K, T>::roundUpToPowerOfTwo(size_t count)
+    {
+        size_t rounded = 1;
+        while (rounded < count)
+        {
+            rounded *= 2;
         }
+        return rounded;
+    }
 
-        delete synonymIterator_;
-        synonymIterator_ = nullptr;
+    template <typename K, typename T>
+    HashTable<K, T>::HashTableIterator::HashTableIterator(BucketBlockType* buckets, size_t bucketCount, size_t bucketIndex,
+        BucketBlockType* nextBuckets, size_t nextBucketCount) :
+        buckets_(buckets),
+        bucketCount_(bucketCount),
+        bucketIndex_(bucketIndex),
+        nextBuckets_(nextBuckets),
+        nextBucketCount_(nextBucketCount),
+        synonymIterator_(nullptr)
+    {
+        this->enterNonEmptyBucket();
+    }
 
-        ++(*tablesCurrent_);
-        while (*tablesCurrent_ != *tablesLast_
-            && **tablesCurrent_ == nullptr)
+    template <typename K, typename T>
+    typename HashTable<K, T>::HashTableIterator& HashTable<K, T>::HashTableIterator::operator++()
+    {
+        if (bucketIndex_ == bucketCount_)
         {
-            ++(*tablesCurrent_);                      
+            return *this;
         }
 
-        if (*tablesCurrent_ != *tablesLast_) {
-            synonymIterator_ =
-                new SynonymTableIterator((**tablesCurrent_)->begin());
+        ++synonymIterator_;
+        if (synonymIterator_ == SynonymTableIterator(nullptr))
+        {
+            ++bucketIndex_;
+            this->enterNonEmptyBucket();
         }
         return *this;
     }
@@ -798,10 +1677,7 @@ namespace ds::adt {
     template <typename K, typename T>
     bool HashTable<K, T>::HashTableIterator::operator==(const HashTableIterator& other) const
     {
-        return synonymIterator_ == other.synonymIterator_ ||
-                 (synonymIterator_ != nullptr &&
-                   other.synonymIterator_ != nullptr &&
-                   *synonymIterator_ == *(other.synonymIterator_));
+        return buckets_ == other.buckets_ && bucketIndex_ == other.bucketIndex_ && synonymIterator_ == other.synonymIterator_;
     }
 
     template <typename K, typename T>
@@ -813,25 +1689,53 @@ namespace ds::adt {
     template <typename K, typename T>
     TableItem<K, T>& HashTable<K, T>::HashTableIterator::operator*()
     {
-        return (**synonymIterator_);
+        return *synonymIterator_;
+    }
+
+    template <typename K, typename T>
+    void HashTable<K, T>::HashTableIterator::enterNonEmptyBucket()
+    {
+        while (true)
+        {
+            while (bucketIndex_ < bucketCount_)
+            {
+                SynonymTable* bucket = buckets_[bucketIndex_].data_;
+                if (bucket != nullptr)
+                {
+                    synonymIterator_ = bucket->begin();
+                    return;
+                }
+                ++bucketIndex_;
+            }
+
+            if (nextBuckets_ == nullptr)
+            {
+                break;
+            }
+            buckets_ = nextBuckets_;
+            bucketCount_ = nextBucketCount_;
+            bucketIndex_ = 0;
+            nextBuckets_ = nullptr;
+            nextBucketCount_ = 0;
+        }
+        synonymIterator_ = SynonymTableIterator(nullptr);
     }
 
     template <typename K, typename T>
     typename HashTable<K, T>::HashTableIterator HashTable<K, T>::begin() const
     {
-        return HashTableIterator(
-            new PrimaryRegionIterator(primaryRegion_->begin()), 
-            new PrimaryRegionIterator(primaryRegion_->end())
-        );
+        if (oldRegion_ != nullptr)
+        {
+            return HashTableIterator(oldRegion_->accessFirst(), oldRegion_->size(), migratedBuckets_,
+                primaryRegion_->accessFirst(), primaryRegion_->size());
+        }
+        return HashTableIterator(primaryRegion_->accessFirst(), primaryRegion_->size(), 0, nullptr, 0);
     }
 
     template <typename K, typename T>
     typename HashTable<K, T>::HashTableIterator HashTable<K, T>::end() const
     {
-        return HashTableIterator(
-            new PrimaryRegionIterator(primaryRegion_->end()), 
-            new PrimaryRegionIterator(primaryRegion_->end())
-        );
+        return HashTableIterator(primaryRegion_->accessFirst(), primaryRegion_->size(), primaryRegion_->size(), nullptr, 0);
     }
 
     //----------
@@ -850,6 +1754,20 @@ namespace ds::adt {
     {
     }
 
+    template<typename K, typename T, typename ItemType>
+    GeneralBinarySearchTree<K, T, ItemType>::GeneralBinarySearchTree(amt::BinaryEH<ItemType>* hierarchy):
+        ADS<ItemType>(hierarchy),
+        size_(0)
+    {
+    }
+
+    template<typename K, typename T, typename ItemType>
+    GeneralBinarySearchTree<K, T, ItemType>::GeneralBinarySearchTree(amt::BinaryEH<ItemType>* hierarchy, const GeneralBinarySearchTree& other):
+        ADS<ItemType>(hierarchy, other),
+        size_(other.size_)
+    {
+    }
+
     template<typename K, typename T, typename ItemType>
     GeneralBinarySearchTree<K, T, ItemType>::~GeneralBinarySearchTree()
     {
@@ -862,6 +1780,12 @@ namespace ds::adt {
         return size_;
     }
 
+    template<typename K, typename T, typename ItemType>
+    bool GeneralBinarySearchTree<K, T, ItemType>::isEmpty() const
+    {
+        return this->getHierarchy()->isEmpty();
+    }
+
     template<typename K, typename T, typename ItemType>
     void GeneralBinarySearchTree<K, T, ItemType>::clear()
     {
@@ -935,6 +1859,67 @@ namespace ds::adt {
         return this->getHierarchy()->end();
     }
 
+    template<typename K, typename T, typename ItemType>
+    auto GeneralBinarySearchTree<K, T, ItemType>::lowerBound(const K& key) const -> RangeIterator
+    {
+        BSTNodeType* bound = nullptr;
+        BSTNodeType* node = this->isEmpty() ? nullptr : this->getHierarchy()->accessRoot();
+        while (node != nullptr)
+        {
+            if (node->data_.key_ < key)
+            {
+                node = node->right_;
+            }
+            else
+            {
+                bound = node;
+                node = node->left_;
+            }
+        }
+        return RangeIterator(bound);
+    }
+
+    template<typename K, typename T, typename ItemType>
+    auto GeneralBinarySearchTree<K, T, ItemType>::upperBound(const K& key) const -> RangeIterator
+    {
+        BSTNodeType* bound = nullptr;
+        BSTNodeType* node = this->isEmpty() ? nullptr : this->getHierarchy()->accessRoot();
+        while (node != nullptr)
+        {
+            if (key < node->data_.key_)
+            {
+                bound = node;
+                node = node->left_;
+            }
+            else
+            {
+                node = node->right_;
+            }
+        }
+        return RangeIterator(bound);
+    }
+
+    template<typename K, typename T, typename ItemType>
+    auto GeneralBinarySearchTree<K, T, ItemType>::equalRange(const K& key) const -> RangeType
+    {
+        BSTNodeType* node = nullptr;
+        if (!this->tryFindNodeWithKey(key, node))
+        {
+            const RangeIterator bound = this->lowerBound(key);
+            return RangeType(bound, bound);
+        }
+        RangeIterator first(node);
+        RangeIterator last(node);
+        return RangeType(first, ++last);
+    }
+
+    template<typename K, typename T, typename ItemType>
+    auto GeneralBinarySearchTree<K, T, ItemType>::range(const K& from, const K& to) const -> RangeType
+    {
+        const RangeIterator first = this->lowerBound(from);
+        return RangeType(first, from < to ? this->lowerBound(to) : first);
+    }
+
     template<typename K, typename T, typename ItemType>
     amt::BinaryEH<ItemType>* GeneralBinarySearchTree<K, T, ItemType>::getHierarchy() const
     {
@@ -944,63 +1929,180 @@ namespace ds::adt {
     template<typename K, typename T, typename ItemType>
     void GeneralBinarySearchTree<K, T, ItemType>::removeNode(BSTNodeType* node)
     {
-        // TODO 11
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        this->unlinkNode(node);
     }
 
     template<typename K, typename T, typename ItemType>
-    bool GeneralBinarySearchTree<K, T, ItemType>::tryFindNodeWithKey(const K& key, BSTNodeType*& node) const
+    auto GeneralBinarySearchTree<K, T, ItemType>::unlinkNode(BSTNodeType* node) -> BSTNodeType*
     {
-        if (this->isEmpty())
+        amt::BinaryEH<ItemType>* hierarchy = this->getHierarchy();
+        if (hierarchy->hasLeftSon(*node) && hierarchy->hasRightSon(*node))
         {
-            return false;
+            BSTNodeType* successor = hierarchy->accessRightSon(*node);
+            while (hierarchy->hasLeftSon(*successor))
+            {
+                successor = hierarchy->accessLeftSon(*successor);
+            }
+            node->data_.key_ = std::move(successor->data_.key_);
+            node->data_.data_ = std::move(successor->data_.data_);
+            node = successor;
         }
 
-        node = this->getHierarchy()->accessRoot();
-        while (node->data_.key_ != key && !this->getHierarchy()->isLeaf(*node))
+        BSTNodeType* son = nullptr;
+        if (hierarchy->hasLeftSon(*node))
         {
-            if (key < node->data_.key_)
+            son = hierarchy->accessLeftSon(*node);
+            hierarchy->changeLeftSon(*node, nullptr);
+        }
+        else if (hierarchy->hasRightSon(*node))
+        {
+            son = hierarchy->accessRightSon(*node);
+            hierarchy->changeRightSon(*node, nullptr);
+        }
+
+        // The node has no sons now, so removing it releases just its block.
+        BSTNodeType* parent = hierarchy->accessParent(*node);
+        if (parent == nullptr)
+        {
+            hierarchy->clear();
+            hierarchy->changeRoot(son);
+        }
+        else if (hierarchy->isLeftSon(*node))
+        {
+            hierarchy->removeLeftSon(*parent);
+            hierarchy->changeLeftSon(*parent, son);
+        }
+        else
+        {
+            hierarchy->removeRightSon(*parent);
+            hierarchy->changeRightSon(*parent, son);
+        }
+        return parent;
+    }
+
+    template<typename K, typename T, typename ItemType>
+    bool GeneralBinarySearchTree<K, T, ItemType>::tryFindNodeWithKey(const K& key, BSTNodeType*& node) const
+    {
+        // Follows the sons directly, the hierarchy would be looked up at every level otherwise.
+        BSTNodeType* current = this->getHierarchy()->accessRoot();
+        while (current != nullptr)
+        {
+            node = current;
+            if (current->data_.key_ == key)
             {
-                if (this->getHierarchy()->hasLeftSon(*node))
-                {
-                    node = this->getHierarchy()->accessLeftSon(*node);
-                }
-                else
-                {
-                    return false;
-                }
+                return true;
             }
-            else
+            current = key < current->data_.key_ ? current->left_ : current->right_;
+        }
+        return false;
+    }
+
+    template<typename K, typename T, typename ItemType>
+    void GeneralBinarySearchTree<K, T, ItemType>::rotateLeft(BSTNodeType* node)
+    {
+        amt::BinaryEH<ItemType>* hierarchy = this->getHierarchy();
+        BSTNodeType* parent = hierarchy->accessParent(*node);
+        BSTNodeType* son = hierarchy->accessRightSon(*node);
+        BSTNodeType* grandson = hierarchy->accessLeftSon(*son);
+        const bool isLeftSon = hierarchy->isLeftSon(*node);
+
+        hierarchy->changeLeftSon(*son, nullptr);
+        hierarchy->changeRightSon(*node, grandson);
+        if (parent == nullptr)
+        {
+            hierarchy->changeRoot(son);
+        }
+        else if (isLeftSon)
+        {
+            hierarchy->changeLeftSon(*parent, son);
+        }
+        else
+        {
+            hierarchy->changeRightSon(*parent, son);
+        }
+        hierarchy->changeLeftSon(*son, node);
+    }
+
+    template<typename K, typename T, typename ItemType>
+    void GeneralBinarySearchTree<K, T, ItemType>::rotateRight(BSTNodeType* node)
+    {
+        amt::BinaryEH<ItemType>* hierarchy = this->getHierarchy();
+        BSTNodeType* parent = hierarchy->accessParent(*node);
+        BSTNodeType* son = hierarchy->accessLeftSon(*node);
+        BSTNodeType* grandson = hierarchy->accessRightSon(*son);
+        const bool isLeftSon = hierarchy->isLeftSon(*node);
+
+        hierarchy->changeRightSon(*son, nullptr);
+        hierarchy->changeLeftSon(*node, grandson);
+        if (parent == nullptr)
+        {
+            hierarchy->changeRoot(son);
+        }
+        else if (isLeftSon)
+        {
+            hierarchy->changeLeftSon(*parent, son);
+        }
+        else
+        {
+            hierarchy->changeRightSon(*parent, son);
+        }
+        hierarchy->changeRightSon(*son, node);
+    }
+
+    template<typename K, typename T, typename ItemType>
+    GeneralBinarySearchTree<K, T, ItemType>::RangeIterator::RangeIterator(BSTNodeType* node) :
+        node_(node)
+    {
+    }
+
+    template<typename K, typename T, typename ItemType>
+    auto GeneralBinarySearchTree<K, T, ItemType>::RangeIterator::operator++() -> RangeIterator&
+    {
+        if (node_->right_ != nullptr)
+        {
+            node_ = node_->right_;
+            while (node_->left_ != nullptr)
             {
-                if (this->getHierarchy()->hasRightSon(*node))
-                {
-                    node = this->getHierarchy()->accessRightSon(*node);
-                }
-                else
-                {
-                    return false;
-                }
+                node_ = node_->left_;
             }
+            return *this;
         }
 
-        return node->data_.key_ == key;
+        // Up while coming from a right son, the first parent reached from a left son is next.
+        BSTNodeType* son = node_;
+        node_ = static_cast<BSTNodeType*>(node_->parent_);
+        while (node_ != nullptr && node_->right_ == son)
+        {
+            son = node_;
+            node_ = static_cast<BSTNodeType*>(node_->parent_);
+        }
+        return *this;
     }
 
     template<typename K, typename T, typename ItemType>
-    void GeneralBinarySearchTree<K, T, ItemType>::rotateLeft(BSTNodeType* node)
+    auto GeneralBinarySearchTree<K, T, ItemType>::RangeIterator::operator++(int) -> RangeIterator
     {
-        // TODO 11
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        RangeIterator tmp(*this);
+        this->operator++();
+        return tmp;
     }
 
     template<typename K, typename T, typename ItemType>
-    void GeneralBinarySearchTree<K, T, ItemType>::rotateRight(BSTNodeType* node)
+    bool GeneralBinarySearchTree<K, T, ItemType>::RangeIterator::operator==(const RangeIterator& other) const
     {
-        // TODO 11
-        // po implementacii vymazte vyhodenie vynimky!
-        throw std::runtime_error("Not implemented yet");
+        return node_ == other.node_;
+    }
+
+    template<typename K, typename T, typename ItemType>
+    bool GeneralBinarySearchTree<K, T, ItemType>::RangeIterator::operator!=(const RangeIterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    template<typename K, typename T, typename ItemType>
+    ItemType& GeneralBinarySearchTree<K, T, ItemType>::RangeIterator::operator*()
+    {
+        return node_->data_;
     }
 
     //----------
@@ -1044,4 +2146,154 @@ namespace ds::adt {
         // po implementacii vymazte vyhodenie vynimky!
         throw std::runtime_error("Not implemented yet");
     }
+
+    //----------
+
+    template<typename K, typename T>
+    AVLTree<K, T>::AVLTree():
+        BaseType(new HierarchyType(new mm::PoolMemoryManager<BSTNodeType>()))
+    {
+    }
+
+    template<typename K, typename T>
+    AVLTree<K, T>::AVLTree(const AVLTree& other):
+        BaseType(new HierarchyType(new mm::PoolMemoryManager<BSTNodeType>()), other)
+    {
+    }
+
+    template<typename K, typename T>
+    size_t AVLTree<K, T>::size() const
+    {
+        return subtreeSize(this->getHierarchy()->accessRoot());
+    }
+
+    template<typename K, typename T>
+    bool AVLTree<K, T>::equals(const ADT& other)
+    {
+        return Table<K, T>::areEqual(*this, other);
+    }
+
+    template<typename K, typename T>
+    size_t AVLTree<K, T>::rank(const K& key) const
+    {
+        size_t result = 0;
+        BSTNodeType* node = this->getHierarchy()->accessRoot();
+        while (node != nullptr)
+        {
+            if (node->data_.key_ < key)
+            {
+                result += subtreeSize(node->left_) + 1;
+                node = node->right_;
+            }
+            else
+            {
+                node = node->left_;
+            }
+        }
+        return result;
+    }
+
+    template<typename K, typename T>
+    TableItem<K, T>& AVLTree<K, T>::select(size_t index) const
+    {
+        if (index >= this->size())
+        {
+            throw std::out_of_range("Invalid index!");
+        }
+
+        BSTNodeType* node = this->getHierarchy()->accessRoot();
+        while (true)
+        {
+            const size_t leftSize = subtreeSize(node->left_);
+            if (index < leftSize)
+            {
+                node = node->left_;
+            }
+            else if (index > leftSize)
+            {
+                index -= leftSize + 1;
+                node = node->right_;
+            }
+            else
+            {
+                return node->data_;
+            }
+        }
+    }
+
+    template<typename K, typename T>
+    void AVLTree<K, T>::removeNode(BSTNodeType* node)
+    {
+        this->rebalance(this->unlinkNode(node));
+    }
+
+    template<typename K, typename T>
+    void AVLTree<K, T>::balanceTree(BSTNodeType* node)
+    {
+        this->rebalance(node);
+    }
+
+    template<typename K, typename T>
+    size_t AVLTree<K, T>::height(const BSTNodeType* node)
+    {
+        return node != nullptr ? node->data_.height_ : 0;
+    }
+
+    template<typename K, typename T>
+    size_t AVLTree<K, T>::subtreeSize(const BSTNodeType* node)
+    {
+        return node != nullptr ? node->data_.subtreeSize_ : 0;
+    }
+
+    template<typename K, typename T>
+    std::ptrdiff_t AVLTree<K, T>::balanceOf(const BSTNodeType* node)
+    {
+        return static_cast<std::ptrdiff_t>(height(node->left_)) - static_cast<std::ptrdiff_t>(height(node->right_));
+    }
+
+    template<typename K, typename T>
+    void AVLTree<K, T>::updateNode(BSTNodeType* node)
+    {
+        node->data_.height_ = std::max(height(node->left_), height(node->right_)) + 1;
+        node->data_.subtreeSize_ = subtreeSize(node->left_) + subtreeSize(node->right_) + 1;
+    }
+
+    template<typename K, typename T>
+    void AVLTree<K, T>::rebalance(BSTNodeType* node)
+    {
+        HierarchyType* hierarchy = this->getHierarchy();
+        while (node != nullptr)
+        {
+            updateNode(node);
+            const std::ptrdiff_t balance = balanceOf(node);
+            if (balance > 1 || balance < -1)
+            {
+                // The heavier son becomes the root of the subtree, its inner son is lifted first.
+                BSTNodeType* son = balance > 1 ? node->left_ : node->right_;
+                if (balance > 1 && balanceOf(son) < 0)
+                {
+                    this->rotateLeft(son);
+                    updateNode(son);
+                }
+                else if (balance < -1 && balanceOf(son) > 0)
+                {
+                    this->rotateRight(son);
+                    updateNode(son);
+                }
+
+                if (balance > 1)
+                {
+                    this->rotateRight(node);
+                }
+                else
+                {
+                    this->rotateLeft(node);
+                }
+                updateNode(node);
+                node = hierarchy->accessParent(*node);
+                updateNode(node);
+            }
+            node = hierarchy->accessParent(*node);
+        }
+    }
 }
\ No newline at end of file
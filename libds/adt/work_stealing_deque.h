@@ -0,0 +1,315 @@
+#pragma once
+
+#include <libds/adt/stack.h>
+#include <libds/constants.h>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace ds::adt {
+
+    /**
+     * @brief Lock-free work-stealing deque (Chase and Lev).
+     *
+     * The owner thread uses the stack interface (push, pop, tryPop) at the bottom, while any
+     * number of thieves take the oldest elements from the top with steal. The circular array
+     * doubles when the owner finds it full; the replaced arrays are kept until the deque is
+     * destroyed, because a thief may still read from them. Elements are stored in atomic
+     * slots, so T must be trivially copyable (typically a task pointer or an index range).
+     * peek is unavailable, since the bottom element can be stolen at any time. clear, assign
+     * and equals are owner operations which expect no concurrent thieves.
+     */
+    template<typename T>
+    class WorkStealingDeque :
+        public Stack<T>
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Elements of a work-stealing deque must be trivially copyable.");
+
+    public:
+        WorkStealingDeque();
+        explicit WorkStealingDeque(size_t capacity);
+        WorkStealingDeque(const WorkStealingDeque& other);
+
+        size_t getCapacity() const;
+
+        ADT& assign(const ADT& other) override;
+        void clear() override;
+        size_t size() const override;
+        bool isEmpty() const override;
+        bool equals(const ADT& other) override;
+
+        void push(T element) override;
+        T& peek() override; // throw(unavailable_function_call)
+        T pop() override;
+
+        /**
+         * @brief Removes the most recently pushed element and moves it to @p element.
+         * Only the owner may call it.
+         * @return false if the deque was empty, @p element is unchanged then.
+         */
+        bool tryPop(T& element);
+
+        /**
+         * @brief Removes the oldest element and moves it to @p element. Any thread may call it.
+         * @return false if the deque was empty or another thread took the element first,
+         * @p element is unchanged then.
+         */
+        bool steal(T& element);
+
+        static const size_t INIT_CAPACITY = 64;
+
+    private:
+        class CircularArray
+        {
+        public:
+            explicit CircularArray(size_t capacity);
+
+            size_t getCapacity() const;
+            T get(std::ptrdiff_t index) const;
+            void put(std::ptrdiff_t index, T element);
+
+        private:
+            std::unique_ptr<std::atomic<T>[]> slots_;
+            size_t mask_;
+        };
+
+        CircularArray* grow(CircularArray* array, std::ptrdiff_t bottom, std::ptrdiff_t top);
+
+    private:
+        std::vector<std::unique_ptr<CircularArray>> arrays_;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::ptrdiff_t> top_;
+        alignas(CACHE_LINE_SIZE) std::atomic<std::ptrdiff_t> bottom_;
+        std::atomic<CircularArray*> array_;
+    };
+
+    //----------
+
+    template<typename T>
+    WorkStealingDeque<T>::WorkStealingDeque() :
+        WorkStealingDeque(INIT_CAPACITY)
+    {
+    }
+
+    template<typename T>
+    WorkStealingDeque<T>::WorkStealingDeque(size_t capacity) :
+        top_(0),
+        bottom_(0),
+        array_(nullptr)
+    {
+        arrays_.push_back(std::make_unique<CircularArray>(capacity));
+        array_.store(arrays_.back().get(), std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    WorkStealingDeque<T>::WorkStealingDeque(const WorkStealingDeque& other) :
+        WorkStealingDeque(other.getCapacity())
+    {
+        this->assign(other);
+    }
+
+    template<typename T>
+    size_t WorkStealingDeque<T>::getCapacity() const
+    {
+        return array_.load(std::memory_order_relaxed)->getCapacity();
+    }
+
+    template<typename T>
+    ADT& WorkStealingDeque<T>::assign(const ADT& other)
+    {
+        if (this != &other)
+        {
+            const WorkStealingDeque<T>& otherDeque = dynamic_cast<const WorkStealingDeque<T>&>(other);
+            this->clear();
+
+            const CircularArray* otherArray = otherDeque.array_.load();
+            const std::ptrdiff_t end = otherDeque.bottom_.load();
+            for (std::ptrdiff_t index = otherDeque.top_.load(); index < end; ++index)
+            {
+                this->push(otherArray->get(index));
+            }
+        }
+        return *this;
+    }
+
+    template<typename T>
+    void WorkStealingDeque<T>::clear()
+    {
+        bottom_.store(top_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    size_t WorkStealingDeque<T>::size() const
+    {
+        const std::ptrdiff_t top = top_.load(std::memory_order_relaxed);
+        const std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+    }
+
+    template<typename T>
+    bool WorkStealingDeque<T>::isEmpty() const
+    {
+        return this->size() == 0;
+    }
+
+    template<typename T>
+    bool WorkStealingDeque<T>::equals(const ADT& other)
+    {
+        if (this == &other)
+        {
+            return true;
+        }
+
+        const WorkStealingDeque<T>* otherDeque = dynamic_cast<const WorkStealingDeque<T>*>(&other);
+        if (otherDeque == nullptr || this->size() != otherDeque->size())
+        {
+            return false;
+        }
+
+        const CircularArray* myArray = array_.load();
+        const CircularArray* otherArray = otherDeque->array_.load();
+        const std::ptrdiff_t myTop = top_.load();
+        const std::ptrdiff_t otherTop = otherDeque->top_.load();
+        for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(this->size()); ++i)
+        {
+            if (!(myArray->get(myTop + i) == otherArray->get(otherTop + i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template<typename T>
+    void WorkStealingDeque<T>::push(T element)
+    {
+        const std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed);
+        const std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+        CircularArray* array = array_.load(std::memory_order_relaxed);
+        if (bottom - top >= static_cast<std::ptrdiff_t>(array->getCapacity()))
+        {
+            array = this->grow(array, bottom, top);
+        }
+
+        array->put(bottom, element);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    T& WorkStealingDeque<T>::peek()
+    {
+        throw amt::unavailable_function_call("Work-stealing deque can't be peeked, use tryPop!");
+    }
+
+    template<typename T>
+    T WorkStealingDeque<T>::pop()
+    {
+        T result;
+        if (!this->tryPop(result))
+        {
+            throw std::out_of_range("Stack is empty!");
+        }
+        return result;
+    }
+
+    template<typename T>
+    bool WorkStealingDeque<T>::tryPop(T& element)
+    {
+        const std::ptrdiff_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        CircularArray* array = array_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::ptrdiff_t top = top_.load(std::memory_order_relaxed);
+
+        if (top > bottom)
+        {
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+
+        if (top == bottom)
+        {
+            // The last element, thieves compete for it through top.
+            const bool won = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            if (!won)
+            {
+                return false;
+            }
+        }
+
+        element = array->get(bottom);
+        return true;
+    }
+
+    template<typename T>
+    bool WorkStealingDeque<T>::steal(T& element)
+    {
+        std::ptrdiff_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::ptrdiff_t bottom = bottom_.load(std::memory_order_acquire);
+        if (top >= bottom)
+        {
+            return false;
+        }
+
+        const T stolen = array_.load(std::memory_order_acquire)->get(top);
+        if (!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        {
+            return false;
+        }
+
+        element = stolen;
+        return true;
+    }
+
+    template<typename T>
+    auto WorkStealingDeque<T>::grow(CircularArray* array, std::ptrdiff_t bottom, std::ptrdiff_t top) -> CircularArray*
+    {
+        arrays_.push_back(std::make_unique<CircularArray>(2 * array->getCapacity()));
+        CircularArray* newArray = arrays_.back().get();
+        for (std::ptrdiff_t index = top; index < bottom; ++index)
+        {
+            newArray->put(index, array->get(index));
+        }
+        array_.store(newArray, std::memory_order_release);
+        return newArray;
+    }
+
+    //----------
+
+    template<typename T>
+    WorkStealingDeque<T>::CircularArray::CircularArray(size_t capacity) :
+        mask_(0)
+    {
+        size_t roundedCapacity = 1;
+        while (roundedCapacity < capacity)
+        {
+            roundedCapacity *= 2;
+        }
+
+        slots_ = std::make_unique<std::atomic<T>[]>(roundedCapacity);
+        mask_ = roundedCapacity - 1;
+    }
+
+    template<typename T>
+    size_t WorkStealingDeque<T>::CircularArray::getCapacity() const
+    {
+        return mask_ + 1;
+    }
+
+    template<typename T>
+    T WorkStealingDeque<T>::CircularArray::get(std::ptrdiff_t index) const
+    {
+        return slots_[static_cast<size_t>(index) & mask_].load(std::memory_order_relaxed);
+    }
+
+    template<typename T>
+    void WorkStealingDeque<T>::CircularArray::put(std::ptrdiff_t index, T element)
+    {
+        slots_[static_cast<size_t>(index) & mask_].store(element, std::memory_order_relaxed);
+    }
+}
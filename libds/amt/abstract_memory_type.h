@@ -3,6 +3,8 @@
 #include <libds/constants.h>
 #include <libds/mm/compact_memory_manager.h>
 #include <functional>
+#include <type_traits>
+#include <utility>
 
 #pragma warning( disable : 4250 )
 
@@ -23,10 +25,38 @@ namespace ds::amt {
 
 	//----------
 
+	namespace details
+	{
+		/**
+		 * @brief Creates data from @p args, using brace initialization for aggregates.
+		 */
+		template<typename DataType, typename... Args>
+		DataType makeData(Args&&... args)
+		{
+			if constexpr (std::is_aggregate_v<DataType>)
+			{
+				return DataType{ std::forward<Args>(args)... };
+			}
+			else
+			{
+				return DataType(std::forward<Args>(args)...);
+			}
+		}
+	}
+
 	template<typename DataType>
 	struct MemoryBlock
 	{
 		using DataT = DataType;
+
+		MemoryBlock() = default;
+
+		/**
+		 * @brief Constructs data directly from @p args, without a default construction followed by an assignment.
+		 */
+		template<typename... Args>
+		explicit MemoryBlock(std::in_place_t, Args&&... args) : data_(details::makeData<DataType>(std::forward<Args>(args)...)) {}
+
 		DataType data_;
 	};
 
@@ -87,6 +117,13 @@ namespace ds::amt {
 		size_t getCapacity();
 		void changeCapacity(size_t newCapacity);
 
+		/**
+		 * @brief Enables or disables copy-on-write of the underlying memory manager.
+		 * Copies then share the buffer until one of them is mutated.
+		 */
+		void setCopyOnWrite(bool copyOnWrite);
+		bool isCopyOnWrite() const;
+
 		static const int INIT_CAPACITY = 10;
 
 	protected:
@@ -303,6 +340,18 @@ namespace ds::amt {
 		this->getMemoryManager()->changeCapacity(newCapacity);
 	}
 
+	template<typename DataType>
+    void ImplicitAbstractMemoryStructure<DataType>::setCopyOnWrite(bool copyOnWrite)
+	{
+		this->getMemoryManager()->setCopyOnWrite(copyOnWrite);
+	}
+
+	template<typename DataType>
+    bool ImplicitAbstractMemoryStructure<DataType>::isCopyOnWrite() const
+	{
+		return this->getMemoryManager()->isCopyOnWrite();
+	}
+
 	template<typename DataType>
     auto ImplicitAbstractMemoryStructure<DataType>::getMemoryManager() const -> MemoryManagerType*
 	{
@@ -3,6 +3,7 @@
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/hierarchy.h>
 #include <libds/amt/implicit_sequence.h>
+#include <algorithm>
 #include <functional>
 
 namespace ds::amt {
@@ -12,6 +13,8 @@ namespace ds::amt {
 		public MemoryBlock<DataType>
 	{
 		ExplicitHierarchyBlock() : parent_(nullptr) {}
+		template<typename... Args>
+		explicit ExplicitHierarchyBlock(std::in_place_t, Args&&... args) : MemoryBlock<DataType>(std::in_place, std::forward<Args>(args)...), parent_(nullptr) {}
 		~ExplicitHierarchyBlock() { parent_ = nullptr; }
 
 		ExplicitHierarchyBlock<DataType>* parent_;
@@ -27,6 +30,7 @@ namespace ds::amt {
 	{
 	public:
 		ExplicitHierarchy();
+		explicit ExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		ExplicitHierarchy(const ExplicitHierarchy& other);
 
 		AMT& assign(const AMT& other) override;
@@ -40,9 +44,30 @@ namespace ds::amt {
 
 		BlockType& emplaceRoot() override;
 		void changeRoot(BlockType* newRoot) override;
+		BlockType& emplaceSon(BlockType& parent, size_t sonOrder) override;
+
+		/**
+		 * @brief Creates the root with data constructed directly from @p args.
+		 */
+		template<typename... Args>
+		BlockType& emplaceRoot(Args&&... args);
+
+		/**
+		 * @brief Creates a son with data constructed directly from @p args.
+		 */
+		template<typename... Args>
+		BlockType& emplaceSon(BlockType& parent, size_t sonOrder, Args&&... args);
 
 	protected:
+		/**
+		 * @brief Links the newly created @p newSon to @p parent as its son at @p sonOrder.
+		 */
+		virtual void attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon) = 0;
+
 		BlockType* root_;
+
+	private:
+		BlockType& attachNewSon(BlockType& parent, size_t sonOrder, BlockType* newSon);
 	};
 
 	template<typename BlockType>
@@ -55,6 +80,9 @@ namespace ds::amt {
 		public ExplicitHierarchyBlock<DataType>
 	{
 		MultiWayExplicitHierarchyBlock() : sons_(new IS<MultiWayExplicitHierarchyBlock<DataType>*>()) {}
+		template<typename... Args>
+		explicit MultiWayExplicitHierarchyBlock(std::in_place_t, Args&&... args) :
+			ExplicitHierarchyBlock<DataType>(std::in_place, std::forward<Args>(args)...), sons_(new IS<MultiWayExplicitHierarchyBlock<DataType>*>()) {}
 		~MultiWayExplicitHierarchyBlock() { delete sons_; sons_ = nullptr; }
 
 		IS<MultiWayExplicitHierarchyBlock<DataType>*>* sons_;
@@ -63,12 +91,12 @@ namespace ds::amt {
 	template<typename DataType>
 	using MWEHBlock = MultiWayExplicitHierarchyBlock<DataType>;
 
-	template<typename DataType>
+	template<typename DataType, typename BlockT = MultiWayExplicitHierarchyBlock<DataType>>
 	class MultiWayExplicitHierarchy :
-		public ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>
+		public ExplicitHierarchy<BlockT>
 	{
 	public:
-		using BlockType = MultiWayExplicitHierarchyBlock<DataType>;
+		using BlockType = BlockT;
 
 		MultiWayExplicitHierarchy();
 		MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other);
@@ -78,9 +106,11 @@ namespace ds::amt {
 
 		BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
 
-		BlockType& emplaceSon(BlockType& parent, size_t sonOrder) override;
 		void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override;
 		void removeSon(BlockType& parent, size_t sonOrder) override;
+
+	protected:
+		void attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon) override;
 	};
 
 	template<typename DataType>
@@ -88,11 +118,78 @@ namespace ds::amt {
 
 	//----------
 
+	template<typename DataType>
+	struct MultiWaySiblingExplicitHierarchyBlock :
+		public ExplicitHierarchyBlock<DataType>
+	{
+		MultiWaySiblingExplicitHierarchyBlock() : firstSon_(nullptr), nextSibling_(nullptr), degree_(0) {}
+		template<typename... Args>
+		explicit MultiWaySiblingExplicitHierarchyBlock(std::in_place_t, Args&&... args) :
+			ExplicitHierarchyBlock<DataType>(std::in_place, std::forward<Args>(args)...), firstSon_(nullptr), nextSibling_(nullptr), degree_(0) {}
+		~MultiWaySiblingExplicitHierarchyBlock() { firstSon_ = nullptr; nextSibling_ = nullptr; degree_ = 0; }
+
+		MultiWaySiblingExplicitHierarchyBlock<DataType>* firstSon_;
+		MultiWaySiblingExplicitHierarchyBlock<DataType>* nextSibling_;
+		size_t degree_;
+	};
+
+	template<typename DataType>
+	using MWSEHBlock = MultiWaySiblingExplicitHierarchyBlock<DataType>;
+
+	/**
+	 * @brief Multi-way hierarchy in the first-son/next-sibling representation.
+	 *
+	 * Every node holds just two links and its degree, so unlike MultiWayExplicitHierarchy
+	 * it needs no per-node son array. Sons are traversed in O(1) per son, while accessing
+	 * or inserting the n-th son walks the sibling list and takes O(n).
+	 *
+	 * A sibling list has no place for an empty son, so changeSon with a nullptr unlinks the son
+	 * and the following sons move one position down. MultiWayExplicitHierarchy leaves an empty
+	 * slot there instead and the degree of the parent stays the same.
+	 */
+	template<typename DataType>
+	class MultiWaySiblingExplicitHierarchy :
+		public ExplicitHierarchy<MultiWaySiblingExplicitHierarchyBlock<DataType>>
+	{
+	public:
+		using BlockType = MultiWaySiblingExplicitHierarchyBlock<DataType>;
+
+		MultiWaySiblingExplicitHierarchy();
+		MultiWaySiblingExplicitHierarchy(const MultiWaySiblingExplicitHierarchy& other);
+		~MultiWaySiblingExplicitHierarchy() override;
+
+		AMT& assign(const AMT& other) override;
+
+		size_t degree(const BlockType& node) const override;
+
+		BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
+		BlockType* accessNextSon(const BlockType& node, const BlockType* son, size_t& sonOrder) const override;
+
+		void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override;
+		void removeSon(BlockType& parent, size_t sonOrder) override;
+
+	protected:
+		void attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon) override;
+
+	private:
+		BlockType* accessPreviousSibling(const BlockType& parent, size_t sonOrder) const;
+		void linkSon(BlockType& parent, BlockType* previousSibling, BlockType* son);
+		BlockType* unlinkSon(BlockType& parent, BlockType* previousSibling);
+	};
+
+	template<typename DataType>
+	using MultiWaySiblingEH = MultiWaySiblingExplicitHierarchy<DataType>;
+
+	//----------
+
 	template<typename DataType, size_t K>
 	struct KWayExplicitHierarchyBlock :
 		public ExplicitHierarchyBlock<DataType>
 	{
 		KWayExplicitHierarchyBlock() : sons_(new IS<KWayExplicitHierarchyBlock<DataType, K>*>(K, true)) {}
+		template<typename... Args>
+		explicit KWayExplicitHierarchyBlock(std::in_place_t, Args&&... args) :
+			ExplicitHierarchyBlock<DataType>(std::in_place, std::forward<Args>(args)...), sons_(new IS<KWayExplicitHierarchyBlock<DataType, K>*>(K, true)) {}
 		~KWayExplicitHierarchyBlock() { delete sons_; sons_ = nullptr; }
 
 		IS<KWayExplicitHierarchyBlock<DataType, K>*>* sons_;
@@ -101,10 +198,15 @@ namespace ds::amt {
 	template<typename DataType, size_t K>
 	using KWEHBlock = KWayExplicitHierarchyBlock<DataType, K>;
 
+	/**
+	 * @brief K-way hierarchy of explicitly linked blocks.
+	 *
+	 * ExplicitHierarchy comes first to be the primary base, see BinaryExplicitHierarchy.
+	 */
 	template<typename DataType, size_t K>
 	class KWayExplicitHierarchy :
-		public KWayHierarchy<KWayExplicitHierarchyBlock<DataType, K>, K>,
-		public ExplicitHierarchy<KWayExplicitHierarchyBlock<DataType, K>>
+		public ExplicitHierarchy<KWayExplicitHierarchyBlock<DataType, K>>,
+		public KWayHierarchy<KWayExplicitHierarchyBlock<DataType, K>, K>
 	{
 	public:
 		using BlockType = KWayExplicitHierarchyBlock<DataType, K>;
@@ -117,9 +219,11 @@ namespace ds::amt {
 
 		BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
 
-		BlockType& emplaceSon(BlockType& parent, size_t sonOrder) override;
 		void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override;
 		void removeSon(BlockType& parent, size_t sonOrder) override;
+
+	protected:
+		void attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon) override;
 	};
 
 	template<typename DataType, size_t K>
@@ -132,6 +236,9 @@ namespace ds::amt {
 		public ExplicitHierarchyBlock<DataType>
 	{
 		BinaryExplicitHierarchyBlock() : left_(nullptr), right_(nullptr) {}
+		template<typename... Args>
+		explicit BinaryExplicitHierarchyBlock(std::in_place_t, Args&&... args) :
+			ExplicitHierarchyBlock<DataType>(std::in_place, std::forward<Args>(args)...), left_(nullptr), right_(nullptr) {}
 		~BinaryExplicitHierarchyBlock() { left_ = nullptr; right_ = nullptr; }
 
 		BinaryExplicitHierarchyBlock<DataType>* left_;
@@ -141,15 +248,34 @@ namespace ds::amt {
 	template<typename DataType>
 	using BEHBlock = BinaryExplicitHierarchyBlock<DataType>;
 
-	template<typename DataType>
+	/**
+	 * @brief Binary hierarchy of explicitly linked blocks.
+	 *
+	 * ExplicitHierarchy comes first to be the primary base. GCC 12.2 at -O2 miscompiles virtual
+	 * calls made through a non-primary ExplicitHierarchy base of a class derived from this one,
+	 * such as AugmentedBinaryExplicitHierarchy: devirtualization finds no target and folds the
+	 * call to __builtin_unreachable. Reduced, with the bases listed the other way round:
+	 *   struct A { virtual int size() const = 0; };  struct B : virtual A {};
+	 *   struct H : virtual A { virtual void add() = 0; };  struct K : virtual H {};
+	 *   struct E : virtual H, B { int size() const override; void add() override; };
+	 *   struct BE : K, E {};  struct D : BE { void insert() { this->add(); } };
+	 * Calling insert on a local D crashes at -O2, but works with E listed before K
+	 * or with -fno-devirtualize.
+	 */
+	template<typename DataType, typename BlockT = BinaryExplicitHierarchyBlock<DataType>>
 	class BinaryExplicitHierarchy :
-		public BinaryHierarchy<BinaryExplicitHierarchyBlock<DataType>>,
-		public ExplicitHierarchy<BinaryExplicitHierarchyBlock<DataType>>
+		public ExplicitHierarchy<BlockT>,
+		public BinaryHierarchy<BlockT>
 	{
 	public:
-		using BlockType = BinaryExplicitHierarchyBlock<DataType>;
+		using BlockType = BlockT;
 
 		BinaryExplicitHierarchy();
+
+		/**
+		 * @brief Creates an empty hierarchy whose blocks come from @p memoryManager, which it takes ownership of.
+		 */
+		explicit BinaryExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager);
 		BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other);
 		~BinaryExplicitHierarchy() override;
 
@@ -157,7 +283,6 @@ namespace ds::amt {
 
 		BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
 
-		BlockType& emplaceSon(BlockType& parent, size_t sonOrder) override;
 		void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override;
 		void removeSon(BlockType& parent, size_t sonOrder) override;
 
@@ -178,6 +303,9 @@ namespace ds::amt {
 
 		void removeLeftSon(BlockType& parent);
 		void removeRightSon(BlockType& parent);
+
+	protected:
+		void attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon) override;
 	};
 
 	template<typename DataType>
@@ -185,12 +313,143 @@ namespace ds::amt {
 
 	//----------
 
+	template<typename DataType>
+	struct AugmentedMultiWayExplicitHierarchyBlock :
+		public MultiWayExplicitHierarchyBlock<DataType>
+	{
+		AugmentedMultiWayExplicitHierarchyBlock() : subtreeSize_(1) {}
+		template<typename... Args>
+		explicit AugmentedMultiWayExplicitHierarchyBlock(std::in_place_t, Args&&... args) :
+			MultiWayExplicitHierarchyBlock<DataType>(std::in_place, std::forward<Args>(args)...), subtreeSize_(1) {}
+		~AugmentedMultiWayExplicitHierarchyBlock() { subtreeSize_ = 0; }
+
+		size_t subtreeSize_;
+	};
+
+	template<typename DataType>
+	using AugmentedMWEHBlock = AugmentedMultiWayExplicitHierarchyBlock<DataType>;
+
+	/**
+	 * @brief Multi-way explicit hierarchy whose nodes know the size of their subtree.
+	 *
+	 * emplaceSon, changeSon and removeSon update the sizes on the path to the root in O(depth),
+	 * which makes size() and nodeCount(node) O(1). A son passed to changeSon must be detached.
+	 */
+	template<typename DataType>
+	class AugmentedMultiWayExplicitHierarchy :
+		public MultiWayExplicitHierarchy<DataType, AugmentedMultiWayExplicitHierarchyBlock<DataType>>
+	{
+	public:
+		using BlockType = AugmentedMultiWayExplicitHierarchyBlock<DataType>;
+
+		AugmentedMultiWayExplicitHierarchy();
+		AugmentedMultiWayExplicitHierarchy(const AugmentedMultiWayExplicitHierarchy& other);
+
+		size_t size() const override;
+		size_t nodeCount() const override;
+		size_t nodeCount(const BlockType& node) const override;
+
+		void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override;
+		void removeSon(BlockType& parent, size_t sonOrder) override;
+
+	protected:
+		void attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon) override;
+
+	private:
+		using BaseType = MultiWayExplicitHierarchy<DataType, BlockType>;
+
+		void increaseSubtreeSizes(BlockType* node, size_t count);
+		void decreaseSubtreeSizes(BlockType* node, size_t count);
+	};
+
+	template<typename DataType>
+	using AugmentedMultiWayEH = AugmentedMultiWayExplicitHierarchy<DataType>;
+
+	//----------
+
+	template<typename DataType>
+	struct AugmentedBinaryExplicitHierarchyBlock :
+		public BinaryExplicitHierarchyBlock<DataType>
+	{
+		AugmentedBinaryExplicitHierarchyBlock() : subtreeSize_(1), height_(1) {}
+		template<typename... Args>
+		explicit AugmentedBinaryExplicitHierarchyBlock(std::in_place_t, Args&&... args) :
+			BinaryExplicitHierarchyBlock<DataType>(std::in_place, std::forward<Args>(args)...), subtreeSize_(1), height_(1) {}
+		~AugmentedBinaryExplicitHierarchyBlock() { subtreeSize_ = 0; height_ = 0; }
+
+		size_t subtreeSize_;
+		size_t height_;
+	};
+
+	template<typename DataType>
+	using AugmentedBEHBlock = AugmentedBinaryExplicitHierarchyBlock<DataType>;
+
+	/**
+	 * @brief Binary explicit hierarchy whose nodes know the size and the height of their subtree.
+	 *
+	 * Every modification recomputes both values on the path to the root in O(depth).
+	 * In return size(), nodeCount(node) and height(node) are O(1), and the in-order position
+	 * of a node as well as the node at a given in-order position are found in O(depth).
+	 * A son passed to changeSon must be detached.
+	 */
+	template<typename DataType>
+	class AugmentedBinaryExplicitHierarchy :
+		public BinaryExplicitHierarchy<DataType, AugmentedBinaryExplicitHierarchyBlock<DataType>>
+	{
+	public:
+		using BlockType = AugmentedBinaryExplicitHierarchyBlock<DataType>;
+
+		AugmentedBinaryExplicitHierarchy();
+		AugmentedBinaryExplicitHierarchy(const AugmentedBinaryExplicitHierarchy& other);
+
+		size_t size() const override;
+		size_t nodeCount() const override;
+		size_t nodeCount(const BlockType& node) const override;
+		size_t height(const BlockType* node) const;
+
+		void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override;
+		void removeSon(BlockType& parent, size_t sonOrder) override;
+
+		BlockType& insertLeftSon(BlockType& parent);
+		BlockType& insertRightSon(BlockType& parent);
+
+		void changeLeftSon(BlockType& parent, BlockType* newSon);
+		void changeRightSon(BlockType& parent, BlockType* newSon);
+
+		void removeLeftSon(BlockType& parent);
+		void removeRightSon(BlockType& parent);
+
+		BlockType* accessInOrder(size_t index) const;
+		size_t calculateInOrderIndex(const BlockType& node) const;
+
+	protected:
+		void attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon) override;
+
+	private:
+		using BaseType = BinaryExplicitHierarchy<DataType, BlockType>;
+
+		size_t subtreeSize(const BlockType* node) const;
+		void updatePath(BlockType* node);
+	};
+
+	template<typename DataType>
+	using AugmentedBinaryEH = AugmentedBinaryExplicitHierarchy<DataType>;
+
+	//----------
+
 	template<typename BlockType>
     ExplicitHierarchy<BlockType>::ExplicitHierarchy() :
 		root_(nullptr)
 	{
 	}
 
+	template<typename BlockType>
+    ExplicitHierarchy<BlockType>::ExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitAMS<BlockType>(memoryManager),
+		root_(nullptr)
+	{
+	}
+
 	template<typename BlockType>
     ExplicitHierarchy<BlockType>::ExplicitHierarchy(const ExplicitHierarchy& other) :
 		ExplicitHierarchy()
@@ -206,27 +465,20 @@ namespace ds::amt {
 		std::function<void(BlockType*, BlockType*)> copy;
 		copy = [&](BlockType* myBlock, BlockType* otherBlock)
 		{
-		    myBlock->data_ = otherBlock->data_;
-
             const size_t sonCount = otherHierarchy.degree(*otherBlock);
-			size_t copiedSonCount = 0;
-			size_t sonIndex = 0;
-			while (copiedSonCount < sonCount)
+			size_t sonOrder = INVALID_INDEX;
+			BlockType* otherSon = nullptr;
+			for (size_t i = 0; i < sonCount; ++i)
 			{
-				BlockType* otherSon = otherHierarchy.accessSon(*otherBlock, sonIndex);
-				if (otherSon != nullptr)
-				{
-					copy(&this->emplaceSon(*myBlock, sonIndex), otherSon);
-					copiedSonCount++;
-				}
-				sonIndex++;
+				otherSon = otherHierarchy.accessNextSon(*otherBlock, otherSon, sonOrder);
+				copy(&this->emplaceSon(*myBlock, sonOrder, otherSon->data_), otherSon);
 			}
 		};
 
 		this->clear();
 		if (otherHierarchy.root_ != nullptr)
 		{
-			this->emplaceRoot();
+			this->emplaceRoot(otherHierarchy.root_->data_);
 			copy(root_, otherHierarchy.root_);
 		}
 
@@ -287,21 +539,18 @@ namespace ds::amt {
 			else
 			{
 				size_t sonCount = this->degree(*myBlock);
-				size_t sonsProcessed = 0;
-				size_t i = 0;
-				while (sonsProcessed < sonCount)
+				size_t mySonOrder = INVALID_INDEX;
+				size_t otherSonOrder = INVALID_INDEX;
+				BlockType* mySon = nullptr;
+				BlockType* otherSon = nullptr;
+				for (size_t i = 0; i < sonCount; ++i)
 				{
-					BlockType* mySon = this->accessSon(*myBlock, i);
-					BlockType* otherSon = otherHierarchy->accessSon(*otherBlock, i);
-					if (mySon != nullptr)
-					{
-						++sonsProcessed;
-					}
-					if (!compare(mySon, otherSon))
+					mySon = this->accessNextSon(*myBlock, mySon, mySonOrder);
+					otherSon = otherHierarchy->accessNextSon(*otherBlock, otherSon, otherSonOrder);
+					if (mySonOrder != otherSonOrder || !compare(mySon, otherSon))
 					{
 						return false;
 					}
-					++i;
 				}
 				return true;
 			}
@@ -329,6 +578,42 @@ namespace ds::amt {
 		return *root_;
 	}
 
+	template<typename BlockType>
+	template<typename... Args>
+	BlockType& ExplicitHierarchy<BlockType>::emplaceRoot(Args&&... args)
+	{
+		root_ = AMS<BlockType>::memoryManager_->emplaceMemory(std::in_place, std::forward<Args>(args)...);
+		return *root_;
+	}
+
+	template<typename BlockType>
+	BlockType& ExplicitHierarchy<BlockType>::emplaceSon(BlockType& parent, size_t sonOrder)
+	{
+		return this->attachNewSon(parent, sonOrder, AMS<BlockType>::memoryManager_->allocateMemory());
+	}
+
+	template<typename BlockType>
+	template<typename... Args>
+	BlockType& ExplicitHierarchy<BlockType>::emplaceSon(BlockType& parent, size_t sonOrder, Args&&... args)
+	{
+		return this->attachNewSon(parent, sonOrder, AMS<BlockType>::memoryManager_->emplaceMemory(std::in_place, std::forward<Args>(args)...));
+	}
+
+	template<typename BlockType>
+	BlockType& ExplicitHierarchy<BlockType>::attachNewSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
+	{
+		try
+		{
+			this->attachSon(parent, sonOrder, *newSon);
+		}
+		catch (...)
+		{
+			AMS<BlockType>::memoryManager_->releaseMemory(newSon);
+			throw;
+		}
+		return *newSon;
+	}
+
 	template<typename BlockType>
     void ExplicitHierarchy<BlockType>::changeRoot(BlockType* newRoot)
 	{
@@ -339,65 +624,63 @@ namespace ds::amt {
 		root_ = newRoot;
 	}
 
-	template<typename DataType>
-	MultiWayExplicitHierarchy<DataType>::MultiWayExplicitHierarchy() :
-		ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>()
+	template<typename DataType, typename BlockT>
+	MultiWayExplicitHierarchy<DataType, BlockT>::MultiWayExplicitHierarchy() :
+		ExplicitHierarchy<BlockT>()
 	{
 	}
 
-	template<typename DataType>
-	MultiWayExplicitHierarchy<DataType>::MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other) :
-		ExplicitHierarchy<MultiWayExplicitHierarchyBlock<DataType>>()
+	template<typename DataType, typename BlockT>
+	MultiWayExplicitHierarchy<DataType, BlockT>::MultiWayExplicitHierarchy(const MultiWayExplicitHierarchy& other) :
+		ExplicitHierarchy<BlockT>()
 	{
 		this->assign(other);
 	}
 
-    template <typename DataType>
-    MultiWayExplicitHierarchy<DataType>::~MultiWayExplicitHierarchy()
+    template <typename DataType, typename BlockT>
+    MultiWayExplicitHierarchy<DataType, BlockT>::~MultiWayExplicitHierarchy()
     {
 		this->clear();
     }
 
-    template<typename DataType>
-    size_t MultiWayExplicitHierarchy<DataType>::degree(const BlockType& node) const
+    template<typename DataType, typename BlockT>
+    size_t MultiWayExplicitHierarchy<DataType, BlockT>::degree(const BlockType& node) const
 	{
 		return node.sons_->size();
 	}
 
-	template<typename DataType>
-    auto MultiWayExplicitHierarchy<DataType>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
+	template<typename DataType, typename BlockT>
+    auto MultiWayExplicitHierarchy<DataType, BlockT>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
 	{
-		MemoryBlock<BlockType*>* sonBlock = node.sons_->access(sonOrder);
-		return sonBlock != nullptr ? sonBlock->data_ : nullptr;
+		auto* sonBlock = node.sons_->access(sonOrder);
+		return sonBlock != nullptr ? static_cast<BlockType*>(sonBlock->data_) : nullptr;
 	}
 
-	template<typename DataType>
-    auto MultiWayExplicitHierarchy<DataType>::emplaceSon(BlockType& parent, size_t sonOrder) -> BlockType&
+	template<typename DataType, typename BlockT>
+    void MultiWayExplicitHierarchy<DataType, BlockT>::attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon)
 	{
-		BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
-		parent.sons_->insert(sonOrder).data_ = newSon;
-		newSon->parent_ = &parent;
-	    return *newSon;
+		parent.sons_->insert(sonOrder).data_ = &newSon;
+		newSon.parent_ = &parent;
 	}
 
-	template<typename DataType>
-    void MultiWayExplicitHierarchy<DataType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
+	template<typename DataType, typename BlockT>
+    void MultiWayExplicitHierarchy<DataType, BlockT>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
 	{
-		MemoryBlock<BlockType*>* sonBlock = parent.sons_->access(sonOrder);
+		auto* sonBlock = parent.sons_->access(sonOrder);
 
-		BlockType* oldSon = sonBlock->data_;
+		BlockType* oldSon = static_cast<BlockType*>(sonBlock->data_);
 		sonBlock->data_ = newSon;
 
 		if (oldSon != nullptr) { oldSon->parent_ = nullptr; }
 		if (newSon != nullptr) { newSon->parent_ = &parent; }
 	}
 
-	template<typename DataType>
-    void MultiWayExplicitHierarchy<DataType>::removeSon(BlockType& parent, size_t sonOrder)
+	template<typename DataType, typename BlockT>
+    void MultiWayExplicitHierarchy<DataType, BlockT>::removeSon(BlockType& parent, size_t sonOrder)
 	{
-		MemoryBlock<BlockType*>* sonBlock = parent.sons_->access(sonOrder);
+		auto* sonBlock = parent.sons_->access(sonOrder);
 
-		BlockType* removedSon = sonBlock->data_;
+		BlockType* removedSon = static_cast<BlockType*>(sonBlock->data_);
 
 		Hierarchy<BlockType>::processPostOrder(removedSon, [&](BlockType* b)
 		{
@@ -407,6 +690,170 @@ namespace ds::amt {
 		parent.sons_->remove(sonOrder);
 	}
 
+	template<typename DataType>
+	MultiWaySiblingExplicitHierarchy<DataType>::MultiWaySiblingExplicitHierarchy() :
+		ExplicitHierarchy<MultiWaySiblingExplicitHierarchyBlock<DataType>>()
+	{
+	}
+
+	template<typename DataType>
+	MultiWaySiblingExplicitHierarchy<DataType>::MultiWaySiblingExplicitHierarchy(const MultiWaySiblingExplicitHierarchy& other) :
+		ExplicitHierarchy<MultiWaySiblingExplicitHierarchyBlock<DataType>>()
+	{
+		this->assign(other);
+	}
+
+	template<typename DataType>
+	MultiWaySiblingExplicitHierarchy<DataType>::~MultiWaySiblingExplicitHierarchy()
+	{
+		this->clear();
+	}
+
+	template<typename DataType>
+	AMT& MultiWaySiblingExplicitHierarchy<DataType>::assign(const AMT& other)
+	{
+		const MultiWaySiblingExplicitHierarchy<DataType>& otherHierarchy = dynamic_cast<const MultiWaySiblingExplicitHierarchy<DataType>&>(other);
+
+		std::function<void(BlockType*, const BlockType*)> copy;
+		copy = [&](BlockType* myBlock, const BlockType* otherBlock)
+		{
+			BlockType* lastSon = nullptr;
+			for (const BlockType* otherSon = otherBlock->firstSon_; otherSon != nullptr; otherSon = otherSon->nextSibling_)
+			{
+				BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->emplaceMemory(std::in_place, otherSon->data_);
+				this->linkSon(*myBlock, lastSon, newSon);
+				copy(newSon, otherSon);
+				lastSon = newSon;
+			}
+		};
+
+		if (this != &other)
+		{
+			this->clear();
+			if (otherHierarchy.root_ != nullptr)
+			{
+				this->emplaceRoot(otherHierarchy.root_->data_);
+				copy(this->root_, otherHierarchy.root_);
+			}
+		}
+
+		return *this;
+	}
+
+	template<typename DataType>
+	size_t MultiWaySiblingExplicitHierarchy<DataType>::degree(const BlockType& node) const
+	{
+		return node.degree_;
+	}
+
+	template<typename DataType>
+	auto MultiWaySiblingExplicitHierarchy<DataType>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
+	{
+		if (sonOrder >= node.degree_)
+		{
+			return nullptr;
+		}
+
+		BlockType* son = node.firstSon_;
+		for (size_t i = 0; i < sonOrder; ++i)
+		{
+			son = son->nextSibling_;
+		}
+		return son;
+	}
+
+	template<typename DataType>
+	auto MultiWaySiblingExplicitHierarchy<DataType>::accessNextSon(const BlockType& node, const BlockType* son, size_t& sonOrder) const -> BlockType*
+	{
+		++sonOrder;
+		return son == nullptr ? node.firstSon_ : son->nextSibling_;
+	}
+
+	template<typename DataType>
+	void MultiWaySiblingExplicitHierarchy<DataType>::attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon)
+	{
+		if (sonOrder > parent.degree_)
+		{
+			throw std::out_of_range("Invalid son order!");
+		}
+
+		this->linkSon(parent, this->accessPreviousSibling(parent, sonOrder), &newSon);
+	}
+
+	template<typename DataType>
+	void MultiWaySiblingExplicitHierarchy<DataType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
+	{
+		if (sonOrder >= parent.degree_)
+		{
+			throw std::out_of_range("Invalid son order!");
+		}
+
+		BlockType* previousSibling = this->accessPreviousSibling(parent, sonOrder);
+		BlockType* oldSon = this->unlinkSon(parent, previousSibling);
+		oldSon->parent_ = nullptr;
+
+		if (newSon != nullptr)
+		{
+			this->linkSon(parent, previousSibling, newSon);
+		}
+	}
+
+	template<typename DataType>
+	void MultiWaySiblingExplicitHierarchy<DataType>::removeSon(BlockType& parent, size_t sonOrder)
+	{
+		if (sonOrder >= parent.degree_)
+		{
+			throw std::out_of_range("Invalid son order!");
+		}
+
+		BlockType* removedSon = this->unlinkSon(parent, this->accessPreviousSibling(parent, sonOrder));
+
+		Hierarchy<BlockType>::processPostOrder(removedSon, [&](BlockType* b)
+		{
+			AbstractMemoryStructure<BlockType>::memoryManager_->releaseMemory(b);
+		});
+	}
+
+	template<typename DataType>
+	auto MultiWaySiblingExplicitHierarchy<DataType>::accessPreviousSibling(const BlockType& parent, size_t sonOrder) const -> BlockType*
+	{
+		return sonOrder > 0 ? this->accessSon(parent, sonOrder - 1) : nullptr;
+	}
+
+	template<typename DataType>
+	void MultiWaySiblingExplicitHierarchy<DataType>::linkSon(BlockType& parent, BlockType* previousSibling, BlockType* son)
+	{
+		if (previousSibling == nullptr)
+		{
+			son->nextSibling_ = parent.firstSon_;
+			parent.firstSon_ = son;
+		}
+		else
+		{
+			son->nextSibling_ = previousSibling->nextSibling_;
+			previousSibling->nextSibling_ = son;
+		}
+		son->parent_ = &parent;
+		++parent.degree_;
+	}
+
+	template<typename DataType>
+	auto MultiWaySiblingExplicitHierarchy<DataType>::unlinkSon(BlockType& parent, BlockType* previousSibling) -> BlockType*
+	{
+		BlockType* son = previousSibling == nullptr ? parent.firstSon_ : previousSibling->nextSibling_;
+		if (previousSibling == nullptr)
+		{
+			parent.firstSon_ = son->nextSibling_;
+		}
+		else
+		{
+			previousSibling->nextSibling_ = son->nextSibling_;
+		}
+		son->nextSibling_ = nullptr;
+		--parent.degree_;
+		return son;
+	}
+
 	template<typename DataType, size_t K>
 	KWayExplicitHierarchy<DataType, K>::KWayExplicitHierarchy() :
 		ExplicitHierarchy<KWayExplicitHierarchyBlock<DataType, K>>()
@@ -448,12 +895,10 @@ namespace ds::amt {
 	}
 
 	template<typename DataType, size_t K>
-    auto KWayExplicitHierarchy<DataType, K>::emplaceSon(BlockType& parent, size_t sonOrder) -> BlockType&
+    void KWayExplicitHierarchy<DataType, K>::attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon)
 	{
-		BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
-		parent.sons_->access(sonOrder)->data_ = newSon;
-		newSon->parent_ = &parent;
-		return *newSon;
+		parent.sons_->access(sonOrder)->data_ = &newSon;
+		newSon.parent_ = &parent;
 	}
 
 	template<typename DataType, size_t K>
@@ -483,27 +928,33 @@ namespace ds::amt {
 		sonBlock->data_ = nullptr;
 	}
 
-	template<typename DataType>
-	BinaryExplicitHierarchy<DataType>::BinaryExplicitHierarchy() :
-		ExplicitHierarchy<BinaryExplicitHierarchyBlock<DataType>>()
+	template<typename DataType, typename BlockT>
+	BinaryExplicitHierarchy<DataType, BlockT>::BinaryExplicitHierarchy() :
+		ExplicitHierarchy<BlockT>()
 	{
 	}
 
-	template<typename DataType>
-	BinaryExplicitHierarchy<DataType>::BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other) :
-		ExplicitHierarchy<BinaryExplicitHierarchyBlock<DataType>>()
+	template<typename DataType, typename BlockT>
+	BinaryExplicitHierarchy<DataType, BlockT>::BinaryExplicitHierarchy(mm::MemoryManager<BlockType>* memoryManager) :
+		ExplicitHierarchy<BlockT>(memoryManager)
+	{
+	}
+
+	template<typename DataType, typename BlockT>
+	BinaryExplicitHierarchy<DataType, BlockT>::BinaryExplicitHierarchy(const BinaryExplicitHierarchy& other) :
+		ExplicitHierarchy<BlockT>()
 	{
 		this->assign(other);
 	}
 
-    template <typename DataType>
-    BinaryExplicitHierarchy<DataType>::~BinaryExplicitHierarchy()
+    template <typename DataType, typename BlockT>
+    BinaryExplicitHierarchy<DataType, BlockT>::~BinaryExplicitHierarchy()
     {
 		this->clear();
     }
 
-    template<typename DataType>
-    size_t BinaryExplicitHierarchy<DataType>::degree(const BlockType& node) const
+    template<typename DataType, typename BlockT>
+    size_t BinaryExplicitHierarchy<DataType, BlockT>::degree(const BlockType& node) const
 	{
 		size_t result = 0;
 		if (node.left_ != nullptr) ++result;
@@ -511,35 +962,36 @@ namespace ds::amt {
 		return result;
 	}
 
-	template<typename DataType>
-    auto BinaryExplicitHierarchy<DataType>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
+	template<typename DataType, typename BlockT>
+    auto BinaryExplicitHierarchy<DataType, BlockT>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
 	{
 		switch (sonOrder)
 		{
 		case BinaryHierarchy<BlockType>::LEFT_SON_INDEX:
-			return node.left_;
+			return static_cast<BlockType*>(node.left_);
 		case BinaryHierarchy<BlockType>::RIGHT_SON_INDEX:
-			return node.right_;
+			return static_cast<BlockType*>(node.right_);
 		default:
 			return nullptr;
 		}
 	}
 
-	template<typename DataType>
-	auto BinaryExplicitHierarchy<DataType>::emplaceSon(BlockType& parent, size_t sonOrder) -> BlockType&
+	template<typename DataType, typename BlockT>
+	void BinaryExplicitHierarchy<DataType, BlockT>::attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon)
 	{
 		if (sonOrder == BinaryHierarchy<BlockType>::LEFT_SON_INDEX)
 		{
-			return this->insertLeftSon(parent);
+			parent.left_ = &newSon;
 		}
 		else
 		{
-			return this->insertRightSon(parent);
+			parent.right_ = &newSon;
 		}
+		newSon.parent_ = &parent;
 	}
 
-	template<typename DataType>
-    void BinaryExplicitHierarchy<DataType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
+	template<typename DataType, typename BlockT>
+    void BinaryExplicitHierarchy<DataType, BlockT>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
 	{
 		if (sonOrder == BinaryHierarchy<BlockType>::LEFT_SON_INDEX)
 		{
@@ -551,8 +1003,8 @@ namespace ds::amt {
 		}
 	}
 
-	template<typename DataType>
-    void BinaryExplicitHierarchy<DataType>::removeSon(BlockType& parent, size_t sonOrder)
+	template<typename DataType, typename BlockT>
+    void BinaryExplicitHierarchy<DataType, BlockT>::removeSon(BlockType& parent, size_t sonOrder)
 	{
 		if (sonOrder == BinaryHierarchy<BlockType>::LEFT_SON_INDEX)
 		{
@@ -564,82 +1016,76 @@ namespace ds::amt {
 		}
 	}
 
-    template <typename DataType>
-    auto BinaryExplicitHierarchy<DataType>::accessLeftSon(const BlockType& node) const -> BlockType*
+    template <typename DataType, typename BlockT>
+    auto BinaryExplicitHierarchy<DataType, BlockT>::accessLeftSon(const BlockType& node) const -> BlockType*
     {
-	    return node.left_;
+	    return static_cast<BlockType*>(node.left_);
 	}
 
-    template <typename DataType>
-    auto BinaryExplicitHierarchy<DataType>::accessRightSon(const BlockType& node) const -> BlockType*
+    template <typename DataType, typename BlockT>
+    auto BinaryExplicitHierarchy<DataType, BlockT>::accessRightSon(const BlockType& node) const -> BlockType*
 	{
-	    return node.right_;
+	    return static_cast<BlockType*>(node.right_);
 	}
 
-    template <typename DataType>
-    bool BinaryExplicitHierarchy<DataType>::isLeftSon(const BlockType& node) const
+    template <typename DataType, typename BlockT>
+    bool BinaryExplicitHierarchy<DataType, BlockT>::isLeftSon(const BlockType& node) const
 	{
 		return node.parent_ != nullptr && this->accessLeftSon(*this->accessParent(node)) == &node;
 	}
 
-    template <typename DataType>
-    bool BinaryExplicitHierarchy<DataType>::isRightSon(const BlockType& node) const
+    template <typename DataType, typename BlockT>
+    bool BinaryExplicitHierarchy<DataType, BlockT>::isRightSon(const BlockType& node) const
 	{
 		return node.parent_ != nullptr && this->accessRightSon(*this->accessParent(node)) == &node;
 	}
 
-    template <typename DataType>
-    bool BinaryExplicitHierarchy<DataType>::hasLeftSon(const BlockType& node) const
+    template <typename DataType, typename BlockT>
+    bool BinaryExplicitHierarchy<DataType, BlockT>::hasLeftSon(const BlockType& node) const
 	{
 	    return node.left_ != nullptr;
 	}
 
-    template <typename DataType>
-    bool BinaryExplicitHierarchy<DataType>::hasRightSon(const BlockType& node) const
+    template <typename DataType, typename BlockT>
+    bool BinaryExplicitHierarchy<DataType, BlockT>::hasRightSon(const BlockType& node) const
 	{
 	    return node.right_ != nullptr;
 	}
 
-    template<typename DataType>
-    auto BinaryExplicitHierarchy<DataType>::insertLeftSon(BlockType& parent) -> BlockType&
+    template<typename DataType, typename BlockT>
+    auto BinaryExplicitHierarchy<DataType, BlockT>::insertLeftSon(BlockType& parent) -> BlockType&
 	{
-		BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
-		parent.left_ = newSon;
-		newSon->parent_ = &parent;
-		return *newSon;
+		return this->emplaceSon(parent, BinaryHierarchy<BlockType>::LEFT_SON_INDEX);
 	}
 
-	template<typename DataType>
-    auto BinaryExplicitHierarchy<DataType>::insertRightSon(BlockType& parent) -> BlockType&
+	template<typename DataType, typename BlockT>
+    auto BinaryExplicitHierarchy<DataType, BlockT>::insertRightSon(BlockType& parent) -> BlockType&
 	{
-		BlockType* newSon = AbstractMemoryStructure<BlockType>::memoryManager_->allocateMemory();
-		parent.right_ = newSon;
-		newSon->parent_ = &parent;
-		return *newSon;
+		return this->emplaceSon(parent, BinaryHierarchy<BlockType>::RIGHT_SON_INDEX);
 	}
 
-	template<typename DataType>
-    void BinaryExplicitHierarchy<DataType>::changeLeftSon(BlockType& parent, BlockType* newSon)
+	template<typename DataType, typename BlockT>
+    void BinaryExplicitHierarchy<DataType, BlockT>::changeLeftSon(BlockType& parent, BlockType* newSon)
 	{
-		BlockType* oldSon = parent.left_;
+		BlockType* oldSon = static_cast<BlockType*>(parent.left_);
 		parent.left_ = newSon;
 		if (oldSon != nullptr) { oldSon->parent_ = nullptr; }
 		if (newSon != nullptr) { newSon->parent_ = &parent; }
 	}
 
-	template<typename DataType>
-    void BinaryExplicitHierarchy<DataType>::changeRightSon(BlockType& parent, BlockType* newSon)
+	template<typename DataType, typename BlockT>
+    void BinaryExplicitHierarchy<DataType, BlockT>::changeRightSon(BlockType& parent, BlockType* newSon)
 	{
-		BlockType* oldSon = parent.right_;
+		BlockType* oldSon = static_cast<BlockType*>(parent.right_);
 		parent.right_ = newSon;
 		if (oldSon != nullptr) { oldSon->parent_ = nullptr; }
 		if (newSon != nullptr) { newSon->parent_ = &parent; }
 	}
 
-	template<typename DataType>
-    void BinaryExplicitHierarchy<DataType>::removeLeftSon(BlockType& parent)
+	template<typename DataType, typename BlockT>
+    void BinaryExplicitHierarchy<DataType, BlockT>::removeLeftSon(BlockType& parent)
 	{
-		BlockType* removedSon = parent.left_;
+		BlockType* removedSon = static_cast<BlockType*>(parent.left_);
 
 		Hierarchy<BlockType>::processPostOrder(removedSon, [&](BlockType* b)
 			{
@@ -649,10 +1095,10 @@ namespace ds::amt {
 		parent.left_ = nullptr;
 	}
 
-	template<typename DataType>
-    void BinaryExplicitHierarchy<DataType>::removeRightSon(BlockType& parent)
+	template<typename DataType, typename BlockT>
+    void BinaryExplicitHierarchy<DataType, BlockT>::removeRightSon(BlockType& parent)
 	{
-		BlockType* removedSon = parent.right_;
+		BlockType* removedSon = static_cast<BlockType*>(parent.right_);
 
 		Hierarchy<BlockType>::processPostOrder(removedSon, [&](BlockType* b)
 			{
@@ -662,4 +1108,234 @@ namespace ds::amt {
 		parent.right_ = nullptr;
 	}
 
+	template<typename DataType>
+	AugmentedMultiWayExplicitHierarchy<DataType>::AugmentedMultiWayExplicitHierarchy() :
+		BaseType()
+	{
+	}
+
+	template<typename DataType>
+	AugmentedMultiWayExplicitHierarchy<DataType>::AugmentedMultiWayExplicitHierarchy(const AugmentedMultiWayExplicitHierarchy& other) :
+		BaseType()
+	{
+		// Assigned here, since attachSon of this class isn't reachable while the base is constructed.
+		this->assign(other);
+	}
+
+	template<typename DataType>
+	size_t AugmentedMultiWayExplicitHierarchy<DataType>::size() const
+	{
+		return this->root_ != nullptr ? this->root_->subtreeSize_ : 0;
+	}
+
+	template<typename DataType>
+	size_t AugmentedMultiWayExplicitHierarchy<DataType>::nodeCount() const
+	{
+		return this->size();
+	}
+
+	template<typename DataType>
+	size_t AugmentedMultiWayExplicitHierarchy<DataType>::nodeCount(const BlockType& node) const
+	{
+		return node.subtreeSize_;
+	}
+
+	template<typename DataType>
+	void AugmentedMultiWayExplicitHierarchy<DataType>::attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon)
+	{
+		BaseType::attachSon(parent, sonOrder, newSon);
+		this->increaseSubtreeSizes(&parent, 1);
+	}
+
+	template<typename DataType>
+	void AugmentedMultiWayExplicitHierarchy<DataType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
+	{
+		BlockType* oldSon = this->accessSon(parent, sonOrder);
+		BaseType::changeSon(parent, sonOrder, newSon);
+		if (oldSon != nullptr) { this->decreaseSubtreeSizes(&parent, oldSon->subtreeSize_); }
+		if (newSon != nullptr) { this->increaseSubtreeSizes(&parent, newSon->subtreeSize_); }
+	}
+
+	template<typename DataType>
+	void AugmentedMultiWayExplicitHierarchy<DataType>::removeSon(BlockType& parent, size_t sonOrder)
+	{
+		BlockType* removedSon = this->accessSon(parent, sonOrder);
+		const size_t removedCount = removedSon != nullptr ? removedSon->subtreeSize_ : 0;
+		BaseType::removeSon(parent, sonOrder);
+		this->decreaseSubtreeSizes(&parent, removedCount);
+	}
+
+	template<typename DataType>
+	void AugmentedMultiWayExplicitHierarchy<DataType>::increaseSubtreeSizes(BlockType* node, size_t count)
+	{
+		for (; node != nullptr; node = this->accessParent(*node))
+		{
+			node->subtreeSize_ += count;
+		}
+	}
+
+	template<typename DataType>
+	void AugmentedMultiWayExplicitHierarchy<DataType>::decreaseSubtreeSizes(BlockType* node, size_t count)
+	{
+		for (; node != nullptr; node = this->accessParent(*node))
+		{
+			node->subtreeSize_ -= count;
+		}
+	}
+
+	template<typename DataType>
+	AugmentedBinaryExplicitHierarchy<DataType>::AugmentedBinaryExplicitHierarchy() :
+		BaseType()
+	{
+	}
+
+	template<typename DataType>
+	AugmentedBinaryExplicitHierarchy<DataType>::AugmentedBinaryExplicitHierarchy(const AugmentedBinaryExplicitHierarchy& other) :
+		BaseType()
+	{
+		// Assigned here, since attachSon of this class isn't reachable while the base is constructed.
+		this->assign(other);
+	}
+
+	template<typename DataType>
+	size_t AugmentedBinaryExplicitHierarchy<DataType>::size() const
+	{
+		return this->subtreeSize(this->root_);
+	}
+
+	template<typename DataType>
+	size_t AugmentedBinaryExplicitHierarchy<DataType>::nodeCount() const
+	{
+		return this->size();
+	}
+
+	template<typename DataType>
+	size_t AugmentedBinaryExplicitHierarchy<DataType>::nodeCount(const BlockType& node) const
+	{
+		return node.subtreeSize_;
+	}
+
+	template<typename DataType>
+	size_t AugmentedBinaryExplicitHierarchy<DataType>::height(const BlockType* node) const
+	{
+		return node != nullptr ? node->height_ : 0;
+	}
+
+	template<typename DataType>
+	void AugmentedBinaryExplicitHierarchy<DataType>::attachSon(BlockType& parent, size_t sonOrder, BlockType& newSon)
+	{
+		BaseType::attachSon(parent, sonOrder, newSon);
+		this->updatePath(&parent);
+	}
+
+	template<typename DataType>
+	void AugmentedBinaryExplicitHierarchy<DataType>::changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon)
+	{
+		BaseType::changeSon(parent, sonOrder, newSon);
+		this->updatePath(&parent);
+	}
+
+	template<typename DataType>
+	void AugmentedBinaryExplicitHierarchy<DataType>::removeSon(BlockType& parent, size_t sonOrder)
+	{
+		BaseType::removeSon(parent, sonOrder);
+		this->updatePath(&parent);
+	}
+
+	template<typename DataType>
+	auto AugmentedBinaryExplicitHierarchy<DataType>::insertLeftSon(BlockType& parent) -> BlockType&
+	{
+		return this->emplaceSon(parent, BinaryHierarchy<BlockType>::LEFT_SON_INDEX);
+	}
+
+	template<typename DataType>
+	auto AugmentedBinaryExplicitHierarchy<DataType>::insertRightSon(BlockType& parent) -> BlockType&
+	{
+		return this->emplaceSon(parent, BinaryHierarchy<BlockType>::RIGHT_SON_INDEX);
+	}
+
+	template<typename DataType>
+	void AugmentedBinaryExplicitHierarchy<DataType>::changeLeftSon(BlockType& parent, BlockType* newSon)
+	{
+		this->changeSon(parent, BinaryHierarchy<BlockType>::LEFT_SON_INDEX, newSon);
+	}
+
+	template<typename DataType>
+	void AugmentedBinaryExplicitHierarchy<DataType>::changeRightSon(BlockType& parent, BlockType* newSon)
+	{
+		this->changeSon(parent, BinaryHierarchy<BlockType>::RIGHT_SON_INDEX, newSon);
+	}
+
+	template<typename DataType>
+	void AugmentedBinaryExplicitHierarchy<DataType>::removeLeftSon(BlockType& parent)
+	{
+		this->removeSon(parent, BinaryHierarchy<BlockType>::LEFT_SON_INDEX);
+	}
+
+	template<typename DataType>
+	void AugmentedBinaryExplicitHierarchy<DataType>::removeRightSon(BlockType& parent)
+	{
+		this->removeSon(parent, BinaryHierarchy<BlockType>::RIGHT_SON_INDEX);
+	}
+
+	template<typename DataType>
+	auto AugmentedBinaryExplicitHierarchy<DataType>::accessInOrder(size_t index) const -> BlockType*
+	{
+		BlockType* node = this->root_;
+		while (node != nullptr)
+		{
+			const size_t leftSize = this->subtreeSize(this->accessLeftSon(*node));
+			if (index < leftSize)
+			{
+				node = this->accessLeftSon(*node);
+			}
+			else if (index == leftSize)
+			{
+				return node;
+			}
+			else
+			{
+				index -= leftSize + 1;
+				node = this->accessRightSon(*node);
+			}
+		}
+		return nullptr;
+	}
+
+	template<typename DataType>
+	size_t AugmentedBinaryExplicitHierarchy<DataType>::calculateInOrderIndex(const BlockType& node) const
+	{
+		size_t index = this->subtreeSize(this->accessLeftSon(node));
+		const BlockType* current = &node;
+		const BlockType* parent = this->accessParent(node);
+		while (parent != nullptr)
+		{
+			if (this->accessRightSon(*parent) == current)
+			{
+				index += this->subtreeSize(this->accessLeftSon(*parent)) + 1;
+			}
+			current = parent;
+			parent = this->accessParent(*parent);
+		}
+		return index;
+	}
+
+	template<typename DataType>
+	size_t AugmentedBinaryExplicitHierarchy<DataType>::subtreeSize(const BlockType* node) const
+	{
+		return node != nullptr ? node->subtreeSize_ : 0;
+	}
+
+	template<typename DataType>
+	void AugmentedBinaryExplicitHierarchy<DataType>::updatePath(BlockType* node)
+	{
+		for (; node != nullptr; node = this->accessParent(*node))
+		{
+			BlockType* leftSon = this->accessLeftSon(*node);
+			BlockType* rightSon = this->accessRightSon(*node);
+			node->subtreeSize_ = 1 + this->subtreeSize(leftSon) + this->subtreeSize(rightSon);
+			node->height_ = 1 + std::max(this->height(leftSon), this->height(rightSon));
+		}
+	}
+
 }
\ No newline at end of file
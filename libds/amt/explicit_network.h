@@ -5,9 +5,26 @@
 #include <libds/amt/implicit_sequence.h>
 #include <libds/amt/explicit_sequence.h>
 #include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace ds::amt {
 
+	/**
+	 * @brief Back-reference from a network node to its place in the gate.
+	 *
+	 * Implicit gates keep the index of the node, explicit gates keep the gate block of the node.
+	 */
+	template<typename NodeBlockType>
+	struct NetworkGateReference
+	{
+		size_t index_ = INVALID_INDEX;
+		typename DoublyLS<NodeBlockType*>::BlockType* block_ = nullptr;
+	};
+
 	template<typename DataType>
 	struct NetworkBlockImplicitRelations :
 		public MemoryBlock<DataType>
@@ -18,6 +35,7 @@ namespace ds::amt {
 		~NetworkBlockImplicitRelations() { delete relations_; relations_ = nullptr; }
 
 		IS<NetworkBlockImplicitRelations<DataType>*>* relations_;
+		NetworkGateReference<NetworkBlockImplicitRelations<DataType>> gate_;
 	};
 
 	template<typename DataType>
@@ -33,11 +51,30 @@ namespace ds::amt {
 		~NetworkBlockExplicitRelations() { delete relations_; relations_ = nullptr; }
 
 		DoublyLS<NetworkBlockExplicitRelations<DataType>*>* relations_;
+		NetworkGateReference<NetworkBlockExplicitRelations<DataType>> gate_;
 	};
 
 	template<typename DataType>
 	using ERNetworkBlock = NetworkBlockExplicitRelations<DataType>;
 
+	template<typename DataType>
+	struct NetworkBlockHashedRelations :
+		public MemoryBlock<DataType>
+	{
+		using RelationBlockType = typename DoublyLS<NetworkBlockHashedRelations<DataType>*>::BlockType;
+		using RelationIndexType = std::unordered_multimap<const NetworkBlockHashedRelations<DataType>*, RelationBlockType*>;
+
+		NetworkBlockHashedRelations() : relations_(new DoublyLS<NetworkBlockHashedRelations<DataType>*>()), relationIndex_(new RelationIndexType()) {}
+		~NetworkBlockHashedRelations() { delete relations_; relations_ = nullptr; delete relationIndex_; relationIndex_ = nullptr; }
+
+		DoublyLS<NetworkBlockHashedRelations<DataType>*>* relations_;
+		RelationIndexType* relationIndex_;
+		NetworkGateReference<NetworkBlockHashedRelations<DataType>> gate_;
+	};
+
+	template<typename DataType>
+	using HRNetworkBlock = NetworkBlockHashedRelations<DataType>;
+
 	//----------
 
 	template<typename BlockType, typename GateType>
@@ -51,7 +88,8 @@ namespace ds::amt {
 		using IteratorType = typename GateType::IteratorType;
 
 		ExplicitNetwork() : gate_(new GateType()) {}
-		~ExplicitNetwork() override { delete gate_; gate_ = nullptr; }
+		ExplicitNetwork(const ExplicitNetwork& other) : ExplicitNetwork() { this->assign(other); }
+		~ExplicitNetwork() override { ExplicitNetwork::clear(); delete gate_; gate_ = nullptr; }
 
 		AMT& assign(const AMT& other) override;
 		void clear() override;
@@ -69,14 +107,64 @@ namespace ds::amt {
 		BlockType& insert() override;
 		void remove(BlockType* node) override;
 
+		/**
+		 * @brief Removes all nodes satisfying the predicate together with their relations in O(V + E).
+		 * @return Number of removed nodes.
+		 */
+		size_t removeWithProperty(std::function<bool(BlockType*)> predicate);
+
 		void connect(BlockType& nodeA, BlockType& nodeB) override;
 		void disconnect(BlockType& nodeA, BlockType& nodeB) override;
 
-		IteratorType begin();
-		IteratorType end();
+		IteratorType begin() const;
+		IteratorType end() const;
 
 	protected:
+		using NodeIndexMap = std::unordered_map<const BlockType*, size_t>;
+
+		virtual void insertRelation(BlockType& nodeFrom, BlockType& nodeTo);
+		virtual void removeRelation(BlockType& nodeFrom, const BlockType& nodeTo);
+		virtual bool containsRelation(const BlockType& nodeFrom, const BlockType& nodeTo) const;
+		virtual void clearRelations(BlockType& node);
+
+		NodeIndexMap calculateNodeIndices() const;
+
 		GateType* gate_;
+
+	private:
+		static constexpr bool HAS_IMPLICIT_GATE = std::is_same_v<GateType, IS<BlockType*>>;
+		static constexpr bool HAS_EXPLICIT_GATE = std::is_same_v<GateType, DoublyLS<BlockType*>>;
+
+		/**
+		 * @brief Removes the node from the gate using its back-reference.
+		 *
+		 * Implicit gate moves its last node to the freed place, so the order of nodes changes.
+		 */
+		void removeFromGate(BlockType* node);
+	};
+
+	/**
+	 * @brief Network whose nodes keep a hash index of their neighbours.
+	 *
+	 * Every relation block is indexed by its target node, so relationExists and
+	 * disconnect run in expected O(1) and remove is O(deg) instead of O(deg^2).
+	 * The price is one hash entry per relation.
+	 */
+	template<typename BlockType, typename GateType>
+	class HashedRelationsNetwork :
+		public ExplicitNetwork<BlockType, GateType>
+	{
+	public:
+		using RelationsBlockType = typename BlockType::RelationBlockType;
+
+		HashedRelationsNetwork() = default;
+		HashedRelationsNetwork(const HashedRelationsNetwork& other) : HashedRelationsNetwork() { this->assign(other); }
+
+	protected:
+		void insertRelation(BlockType& nodeFrom, BlockType& nodeTo) override;
+		void removeRelation(BlockType& nodeFrom, const BlockType& nodeTo) override;
+		bool containsRelation(const BlockType& nodeFrom, const BlockType& nodeTo) const override;
+		void clearRelations(BlockType& node) override;
 	};
 
 	template<typename DataType>
@@ -115,6 +203,24 @@ namespace ds::amt {
 	template<typename DataType>
 	using EGERNetwork = ExplicitGateExplicitRelationsNetwork<DataType>;
 
+	template<typename DataType>
+	class ImplicitGateHashedRelationsNetwork :
+		public HashedRelationsNetwork<HRNetworkBlock<DataType>, IS<HRNetworkBlock<DataType>*>>
+	{
+	};
+
+	template<typename DataType>
+	using IGHRNetwork = ImplicitGateHashedRelationsNetwork<DataType>;
+
+	template<typename DataType>
+	class ExplicitGateHashedRelationsNetwork :
+		public HashedRelationsNetwork<HRNetworkBlock<DataType>, DoublyLS<HRNetworkBlock<DataType>*>>
+	{
+	};
+
+	template<typename DataType>
+	using EGHRNetwork = ExplicitGateHashedRelationsNetwork<DataType>;
+
 	//----------
 
 	template<typename BlockType, typename GateType>
@@ -125,35 +231,27 @@ namespace ds::amt {
 			clear();
 
 			const ExplicitNetwork<BlockType, GateType>& otherExplicitNetwork = dynamic_cast<const  ExplicitNetwork<BlockType, GateType>&>(other);
+			const NodeIndexMap otherIndices = otherExplicitNetwork.calculateNodeIndices();
 
-			otherExplicitNetwork.gate_->processAllBlocksForward([&](GateBlockType* b) { insert().data_ = b->data_->data_; });
-
-			GateBlockType* myBlockFrom = gate_->accessFirst();
-			GateBlockType* otherBlockFrom = otherExplicitNetwork.gate_->accessFirst();
-
-			while (otherBlockFrom != nullptr)
-			{
-				otherBlockFrom->data_->relations_->processAllBlocksForward([&](RelationsBlockType* otherRelationsBlock)
-					{
-						size_t otherGateIndexTo = 0;
-						otherExplicitNetwork.gate_->findBlockWithProperty([&](GateBlockType* otherGateBlockIndexTo)->bool
-							{
-								if (otherGateBlockIndexTo->data_ == otherRelationsBlock->data_)
-								{
-									return true;
-								}
-								else {
-									otherGateIndexTo++;
-									return false;
-								}
-							});
-						GateBlockType* myBlockTo = gate_->access(otherGateIndexTo);
-						connect(*myBlockFrom->data_, *myBlockTo->data_);
-					});
+			std::vector<BlockType*> myNodes;
+			myNodes.reserve(otherExplicitNetwork.size());
+			otherExplicitNetwork.gate_->processAllBlocksForward([&](GateBlockType* b)
+				{
+					BlockType& myNode = insert();
+					myNode.data_ = b->data_->data_;
+					myNodes.push_back(&myNode);
+				});
 
-				myBlockFrom = gate_->accessNext(*myBlockFrom);
-				otherBlockFrom = otherExplicitNetwork.gate_->accessNext(*otherBlockFrom);
-			}
+			// Relations are copied one direction at a time, so each relation keeps its position in both lists.
+			size_t myIndexFrom = 0;
+			otherExplicitNetwork.gate_->processAllBlocksForward([&](GateBlockType* otherBlockFrom)
+				{
+					BlockType* myNodeFrom = myNodes[myIndexFrom++];
+					otherBlockFrom->data_->relations_->processAllBlocksForward([&](RelationsBlockType* otherRelationsBlock)
+						{
+							this->insertRelation(*myNodeFrom, *myNodes[otherIndices.at(otherRelationsBlock->data_)]);
+						});
+				});
 		}
 		return *this;
 	}
@@ -177,16 +275,21 @@ namespace ds::amt {
 	template<typename BlockType, typename GateType>
     bool ExplicitNetwork<BlockType, GateType>::equals(const AMT& other)
 	{
+		if (this == &other) { return true; }
 		if (this->size() != other.size()) { return false; }
 
-		const ExplicitNetwork<BlockType, GateType>& otherExplicitNetwork = dynamic_cast<const ExplicitNetwork<BlockType, GateType>&>(other);
+		const ExplicitNetwork<BlockType, GateType>* otherExplicitNetwork = dynamic_cast<const ExplicitNetwork<BlockType, GateType>*>(&other);
+		if (otherExplicitNetwork == nullptr) { return false; }
+
+		const NodeIndexMap myIndices = this->calculateNodeIndices();
+		const NodeIndexMap otherIndices = otherExplicitNetwork->calculateNodeIndices();
 
 		GateBlockType* myGateBlock = gate_->accessFirst();
-		GateBlockType* otherGateBlock = otherExplicitNetwork.gate_->accessFirst();
+		GateBlockType* otherGateBlock = otherExplicitNetwork->gate_->accessFirst();
 
 		while (myGateBlock != nullptr)
 		{
-			if (myGateBlock->data_ != otherGateBlock->data_) { return false; }
+			if (!(myGateBlock->data_->data_ == otherGateBlock->data_->data_)) { return false; }
 			if (myGateBlock->data_->relations_->size() != otherGateBlock->data_->relations_->size()) { return false; }
 
 			RelationsBlockType* myRelationsBlock = myGateBlock->data_->relations_->accessFirst();
@@ -194,14 +297,14 @@ namespace ds::amt {
 
 			while (myRelationsBlock != nullptr)
 			{
-				if (myRelationsBlock->data_ != otherRelationsBlock->data_) { return false; }
+				if (myIndices.at(myRelationsBlock->data_) != otherIndices.at(otherRelationsBlock->data_)) { return false; }
 
 				myRelationsBlock = myGateBlock->data_->relations_->accessNext(*myRelationsBlock);
 				otherRelationsBlock = otherGateBlock->data_->relations_->accessNext(*otherRelationsBlock);
 			}
 
 			myGateBlock = gate_->accessNext(*myGateBlock);
-			otherGateBlock = otherExplicitNetwork.gate_->accessNext(*otherGateBlock);
+			otherGateBlock = otherExplicitNetwork->gate_->accessNext(*otherGateBlock);
 		}
 
 		return true;
@@ -236,89 +339,286 @@ namespace ds::amt {
 	template<typename BlockType, typename GateType>
     bool ExplicitNetwork<BlockType, GateType>::relationExists(const BlockType& nodeA, const BlockType& nodeB) const
 	{
-		std::function<bool(const BlockType&, const BlockType&)> relationExists;
-		relationExists = [](const BlockType& vrcholOd, const BlockType& vrcholDo)->bool
-		{
-			return vrcholOd.relations_->findBlockWithProperty([&vrcholDo](RelationsBlockType* b)->bool {return b->data_ == &vrcholDo; }) != nullptr;
-		};
-
-		return degree(nodeA) <= degree(nodeB) ? relationExists(nodeA, nodeB) : relationExists(nodeB, nodeA);
+		return degree(nodeA) <= degree(nodeB) ? this->containsRelation(nodeA, nodeB) : this->containsRelation(nodeB, nodeA);
 	}
 
 	template<typename BlockType, typename GateType>
     BlockType& ExplicitNetwork<BlockType, GateType>::insert()
 	{
 		BlockType* newNode = AMS<BlockType>::memoryManager_->allocateMemory();
-		gate_->insertLast().data_ = newNode;
+		GateBlockType& gateBlock = gate_->insertLast();
+		gateBlock.data_ = newNode;
+		if constexpr (HAS_IMPLICIT_GATE)
+		{
+			newNode->gate_.index_ = gate_->size() - 1;
+		}
+		else if constexpr (HAS_EXPLICIT_GATE)
+		{
+			newNode->gate_.block_ = &gateBlock;
+		}
 		return *newNode;
 	}
 
 	template<typename BlockType, typename GateType>
     void ExplicitNetwork<BlockType, GateType>::remove(BlockType* node)
 	{
+		// Relations of the node are removed from the back, which is O(1) for each of them.
 		while (degree(*node) > 0)
 		{
-			disconnect(*node, *node->relations_->accessLast()->data_);
+			BlockType& neighbour = *node->relations_->accessLast()->data_;
+			this->removeRelation(*node, neighbour);
+			this->removeRelation(neighbour, *node);
 		}
 
-		GateBlockType* gateBlock = gate_->accessFirst();
-		if (gateBlock->data_ == node)
+		this->removeFromGate(node);
+		AMS<BlockType>::memoryManager_->releaseMemory(node);
+	}
+
+	template<typename BlockType, typename GateType>
+	size_t ExplicitNetwork<BlockType, GateType>::removeWithProperty(std::function<bool(BlockType*)> predicate)
+	{
+		std::vector<BlockType*> removedList;
+		gate_->processAllBlocksForward([&](GateBlockType* b)
+			{
+				if (predicate(b->data_))
+				{
+					removedList.push_back(b->data_);
+				}
+			});
+		if (removedList.empty())
 		{
-			gate_->removeFirst();
+			return 0;
 		}
-		else
+		const std::unordered_set<const BlockType*> removedNodes(removedList.begin(), removedList.end());
+
+		// Every remaining neighbour of a removed node rebuilds its relations once, without the removed nodes.
+		std::unordered_set<BlockType*> affectedNodes;
+		for (const BlockType* node : removedList)
 		{
-			GateBlockType* prevGateBlock = gate_->findPreviousToBlockWithProperty([&node](GateBlockType* b)->bool
+			node->relations_->processAllBlocksForward([&](RelationsBlockType* b)
 				{
-					return b->data_ == node;
+					if (removedNodes.count(b->data_) == 0)
+					{
+						affectedNodes.insert(b->data_);
+					}
 				});
-			gate_->removeNext(*prevGateBlock);
 		}
 
-		AMS<BlockType>::memoryManager_->releaseMemory(node);
+		std::vector<BlockType*> keptNeighbours;
+		for (BlockType* node : affectedNodes)
+		{
+			keptNeighbours.clear();
+			node->relations_->processAllBlocksForward([&](RelationsBlockType* b)
+				{
+					if (removedNodes.count(b->data_) == 0)
+					{
+						keptNeighbours.push_back(b->data_);
+					}
+				});
+			this->clearRelations(*node);
+			for (BlockType* neighbour : keptNeighbours)
+			{
+				this->insertRelation(*node, *neighbour);
+			}
+		}
+
+		if constexpr (HAS_IMPLICIT_GATE)
+		{
+			// Remaining nodes are shifted to the front in one pass, keeping their order.
+			size_t keptCount = 0;
+			for (size_t i = 0; i < gate_->size(); ++i)
+			{
+				BlockType* node = gate_->access(i)->data_;
+				if (removedNodes.count(node) == 0)
+				{
+					gate_->access(keptCount)->data_ = node;
+					node->gate_.index_ = keptCount;
+					++keptCount;
+				}
+				else
+				{
+					AMS<BlockType>::memoryManager_->releaseMemory(node);
+				}
+			}
+			while (gate_->size() > keptCount)
+			{
+				gate_->removeLast();
+			}
+		}
+		else
+		{
+			for (BlockType* node : removedList)
+			{
+				this->removeFromGate(node);
+				AMS<BlockType>::memoryManager_->releaseMemory(node);
+			}
+		}
+
+		return removedList.size();
 	}
 
 	template<typename BlockType, typename GateBlock>
     void ExplicitNetwork<BlockType, GateBlock>::connect(BlockType& nodeA, BlockType& nodeB)
 	{
-		nodeA.relations_->insertLast().data_ = &nodeB;
-		nodeB.relations_->insertLast().data_ = &nodeA;
+		this->insertRelation(nodeA, nodeB);
+		this->insertRelation(nodeB, nodeA);
 	}
 
 	template<typename BlockType, typename GateBlock>
     void ExplicitNetwork<BlockType, GateBlock>::disconnect(BlockType& nodeA, BlockType& nodeB)
 	{
-		std::function<void(const BlockType&, const BlockType&)> disconnectRelation;
-		disconnectRelation = [](const BlockType& nodeFrom, const BlockType& nodeTo)
+		this->removeRelation(nodeA, nodeB);
+		this->removeRelation(nodeB, nodeA);
+	}
+
+	template<typename BlockType, typename GateType>
+    typename ExplicitNetwork<BlockType, GateType>::IteratorType ExplicitNetwork<BlockType, GateType>::begin() const
+	{
+		return gate_->begin();
+	}
+
+	template<typename BlockType, typename GateType>
+    typename ExplicitNetwork<BlockType, GateType>::IteratorType ExplicitNetwork<BlockType, GateType>::end() const
+	{
+		return gate_->end();
+	}
+
+	template<typename BlockType, typename GateType>
+    void ExplicitNetwork<BlockType, GateType>::insertRelation(BlockType& nodeFrom, BlockType& nodeTo)
+	{
+		nodeFrom.relations_->insertLast().data_ = &nodeTo;
+	}
+
+	template<typename BlockType, typename GateType>
+    void ExplicitNetwork<BlockType, GateType>::removeRelation(BlockType& nodeFrom, const BlockType& nodeTo)
+	{
+		if (nodeFrom.relations_->accessLast()->data_ == &nodeTo)
+		{
+			nodeFrom.relations_->removeLast();
+		}
+		else if (nodeFrom.relations_->accessFirst()->data_ == &nodeTo)
 		{
+			nodeFrom.relations_->removeFirst();
+		}
+		else
+		{
+			RelationsBlockType* prevInRelationsFrom = nodeFrom.relations_->findPreviousToBlockWithProperty([&nodeTo](RelationsBlockType* b) -> bool
+				{
+					return b->data_ == &nodeTo;
+				});
+			nodeFrom.relations_->removeNext(*prevInRelationsFrom);
+		}
+	}
+
+	template<typename BlockType, typename GateType>
+    bool ExplicitNetwork<BlockType, GateType>::containsRelation(const BlockType& nodeFrom, const BlockType& nodeTo) const
+	{
+		return nodeFrom.relations_->findBlockWithProperty([&nodeTo](RelationsBlockType* b)->bool {return b->data_ == &nodeTo; }) != nullptr;
+	}
+
+	template<typename BlockType, typename GateType>
+	void ExplicitNetwork<BlockType, GateType>::clearRelations(BlockType& node)
+	{
+		node.relations_->clear();
+	}
 
-			if (nodeFrom.relations_->accessFirst()->data_ == &nodeTo)
+	template<typename BlockType, typename GateType>
+    typename ExplicitNetwork<BlockType, GateType>::NodeIndexMap ExplicitNetwork<BlockType, GateType>::calculateNodeIndices() const
+	{
+		NodeIndexMap result;
+		result.reserve(gate_->size());
+		gate_->processAllBlocksForward([&result](const GateBlockType* b)
 			{
-				nodeFrom.relations_->removeFirst();
+				const size_t index = result.size();
+				result.emplace(b->data_, index);
+			});
+		return result;
+	}
+
+	template<typename BlockType, typename GateType>
+	void ExplicitNetwork<BlockType, GateType>::removeFromGate(BlockType* node)
+	{
+		if constexpr (HAS_IMPLICIT_GATE)
+		{
+			const size_t index = node->gate_.index_;
+			BlockType* lastNode = gate_->accessLast()->data_;
+			gate_->access(index)->data_ = lastNode;
+			lastNode->gate_.index_ = index;
+			gate_->removeLast();
+		}
+		else if constexpr (HAS_EXPLICIT_GATE)
+		{
+			GateBlockType* prevGateBlock = gate_->accessPrevious(*node->gate_.block_);
+			if (prevGateBlock == nullptr)
+			{
+				gate_->removeFirst();
+			}
+			else
+			{
+				gate_->removeNext(*prevGateBlock);
+			}
+		}
+		else
+		{
+			GateBlockType* gateBlock = gate_->accessFirst();
+			if (gateBlock->data_ == node)
+			{
+				gate_->removeFirst();
 			}
 			else
 			{
-				RelationsBlockType* prevInRelationsFrom = nodeFrom.relations_->findPreviousToBlockWithProperty([&nodeTo](RelationsBlockType* b) -> bool
+				GateBlockType* prevGateBlock = gate_->findPreviousToBlockWithProperty([&node](GateBlockType* b)->bool
 					{
-						return b->data_ == &nodeTo;
+						return b->data_ == node;
 					});
-				nodeFrom.relations_->removeNext(*prevInRelationsFrom);
+				gate_->removeNext(*prevGateBlock);
 			}
-		};
+		}
+	}
+
+	//----------
 
-		disconnectRelation(nodeA, nodeB);
-		disconnectRelation(nodeB, nodeA);
+	template<typename BlockType, typename GateType>
+	void HashedRelationsNetwork<BlockType, GateType>::insertRelation(BlockType& nodeFrom, BlockType& nodeTo)
+	{
+		RelationsBlockType& relationsBlock = nodeFrom.relations_->insertLast();
+		relationsBlock.data_ = &nodeTo;
+		nodeFrom.relationIndex_->emplace(&nodeTo, &relationsBlock);
 	}
 
 	template<typename BlockType, typename GateType>
-    typename ExplicitNetwork<BlockType, GateType>::IteratorType ExplicitNetwork<BlockType, GateType>::begin()
+	void HashedRelationsNetwork<BlockType, GateType>::removeRelation(BlockType& nodeFrom, const BlockType& nodeTo)
 	{
-		return gate_->begin();
+		auto indexIt = nodeFrom.relationIndex_->find(&nodeTo);
+		if (indexIt == nodeFrom.relationIndex_->end())
+		{
+			throw std::logic_error("Relation doesn't exist!");
+		}
+
+		RelationsBlockType* relationsBlock = indexIt->second;
+		nodeFrom.relationIndex_->erase(indexIt);
+
+		RelationsBlockType* prevInRelationsFrom = nodeFrom.relations_->accessPrevious(*relationsBlock);
+		if (prevInRelationsFrom == nullptr)
+		{
+			nodeFrom.relations_->removeFirst();
+		}
+		else
+		{
+			nodeFrom.relations_->removeNext(*prevInRelationsFrom);
+		}
 	}
 
 	template<typename BlockType, typename GateType>
-    typename ExplicitNetwork<BlockType, GateType>::IteratorType ExplicitNetwork<BlockType, GateType>::end()
+	bool HashedRelationsNetwork<BlockType, GateType>::containsRelation(const BlockType& nodeFrom, const BlockType& nodeTo) const
 	{
-		return gate_->end();
+		return nodeFrom.relationIndex_->find(&nodeTo) != nodeFrom.relationIndex_->end();
+	}
+
+	template<typename BlockType, typename GateType>
+	void HashedRelationsNetwork<BlockType, GateType>::clearRelations(BlockType& node)
+	{
+		node.relations_->clear();
+		node.relationIndex_->clear();
 	}
-}
\ No newline at end of file
+}
@@ -33,6 +33,17 @@ namespace ds::amt {
         BlockType& insertAfter(BlockType& block) override;
         BlockType& insertBefore(BlockType& block) override;
 
+        template<typename... Args>
+        BlockType& emplaceFirst(Args&&... args);
+        template<typename... Args>
+        BlockType& emplaceLast(Args&&... args);
+        template<typename... Args>
+        BlockType& emplaceAt(size_t index, Args&&... args);
+        template<typename... Args>
+        BlockType& emplaceAfter(BlockType& block, Args&&... args);
+        template<typename... Args>
+        BlockType& emplaceBefore(BlockType& block, Args&&... args);
+
         void removeFirst() override;
         void removeLast() override;
         void remove(size_t index) override;
@@ -43,6 +54,11 @@ namespace ds::amt {
         virtual void connectBlocks(BlockType* previous, BlockType* next);
         virtual void disconnectBlock(BlockType* block);
 
+        BlockType& linkFirst(BlockType* newBlock);
+        BlockType& linkLast(BlockType* newBlock);
+        BlockType& linkAfter(BlockType& block, BlockType* newBlock);
+        BlockType& linkBefore(BlockType& block, BlockType* newBlock);
+
         BlockType* first_;
         BlockType* last_;
 
@@ -54,6 +70,7 @@ namespace ds::amt {
         public:
             explicit ExplicitSequenceIterator(BlockType* position);
             ExplicitSequenceIterator(const ExplicitSequenceIterator& other);
+            ExplicitSequenceIterator& operator=(const ExplicitSequenceIterator& other) = default;
             ExplicitSequenceIterator& operator++();
             ExplicitSequenceIterator operator++(int);
             bool operator==(const ExplicitSequenceIterator& other) const;
@@ -81,6 +98,8 @@ namespace ds::amt {
     {
 
         SinglyLinkedSequenceBlock() : next_(nullptr) {}
+        template<typename... Args>
+        explicit SinglyLinkedSequenceBlock(std::in_place_t, Args&&... args) : MemoryBlock<DataType>(std::in_place, std::forward<Args>(args)...), next_(nullptr) {}
         ~SinglyLinkedSequenceBlock() { next_ = nullptr; }
 
         SinglyLinkedSequenceBlock<DataType>* next_;
@@ -116,6 +135,8 @@ namespace ds::amt {
     {
 
         DoublyLinkedSequenceBlock() : previous_(nullptr) {}
+        template<typename... Args>
+        explicit DoublyLinkedSequenceBlock(std::in_place_t, Args&&... args) : SLSBlock<DataType>(std::in_place, std::forward<Args>(args)...), previous_(nullptr) {}
         ~DoublyLinkedSequenceBlock() { previous_ = nullptr; }
 
         DoublyLinkedSequenceBlock<DataType>* previous_;
@@ -187,7 +208,7 @@ namespace ds::amt {
             const ExplicitSequence<BlockType>& otherExplicitSequence = dynamic_cast<const ExplicitSequence<BlockType>&>(other);
             otherExplicitSequence.processAllBlocksForward([&](const BlockType* b)
             {
-                this->insertLast().data_ = b->data_;
+                this->emplaceLast(b->data_);
             });
         }
 
@@ -304,29 +325,13 @@ namespace ds::amt {
     template<typename BlockType>
     BlockType& ExplicitSequence<BlockType>::insertFirst()
     {
-        if (this->size() == 0)
-        {
-            first_ = last_ = AMS<BlockType>::memoryManager_->allocateMemory();
-            return *first_;
-        }
-        else
-        {
-            return this->insertBefore(*first_);
-        }
+        return this->linkFirst(AMS<BlockType>::memoryManager_->allocateMemory());
     }
 
     template<typename BlockType>
     BlockType& ExplicitSequence<BlockType>::insertLast()
     {
-        if (this->size() == 0)
-        {
-            first_ = last_ = AMS<BlockType>::memoryManager_->allocateMemory();
-            return *last_;
-        }
-        else
-        {
-            return this->insertAfter(*last_);
-        }
+        return this->linkLast(AMS<BlockType>::memoryManager_->allocateMemory());
     }
 
     template<typename BlockType>
@@ -342,33 +347,52 @@ namespace ds::amt {
     template<typename BlockType>
     BlockType& ExplicitSequence<BlockType>::insertAfter(BlockType& block)
     {
-        BlockType* nextBlock = this->accessNext(block);
-        BlockType* newBlock = AMS<BlockType>::memoryManager_->allocateMemory();
+        return this->linkAfter(block, AMS<BlockType>::memoryManager_->allocateMemory());
+    }
 
-        this->connectBlocks(&block, newBlock);
-        this->connectBlocks(newBlock, nextBlock);
+    template<typename BlockType>
+    BlockType& ExplicitSequence<BlockType>::insertBefore(BlockType& block)
+    {
+        return this->linkBefore(block, AMS<BlockType>::memoryManager_->allocateMemory());
+    }
 
-        if (last_ == &block)
-        {
-            last_ = newBlock;
-        }
-        return *newBlock;
+    template<typename BlockType>
+    template<typename... Args>
+    BlockType& ExplicitSequence<BlockType>::emplaceFirst(Args&&... args)
+    {
+        return this->linkFirst(AMS<BlockType>::memoryManager_->emplaceMemory(std::in_place, std::forward<Args>(args)...));
     }
 
     template<typename BlockType>
-    BlockType& ExplicitSequence<BlockType>::insertBefore(BlockType& block)
+    template<typename... Args>
+    BlockType& ExplicitSequence<BlockType>::emplaceLast(Args&&... args)
     {
-        BlockType* prevBlock = this->accessPrevious(block);
-        BlockType* newBlock = AMS<BlockType>::memoryManager_->allocateMemory();
+        return this->linkLast(AMS<BlockType>::memoryManager_->emplaceMemory(std::in_place, std::forward<Args>(args)...));
+    }
 
-        this->connectBlocks(prevBlock, newBlock);
-        this->connectBlocks(newBlock, &block);
+    template<typename BlockType>
+    template<typename... Args>
+    BlockType& ExplicitSequence<BlockType>::emplaceAt(size_t index, Args&&... args)
+    {
+        return index == 0
+            ? this->emplaceFirst(std::forward<Args>(args)...)
+            : index == this->size()
+                ? this->emplaceLast(std::forward<Args>(args)...)
+                : this->emplaceAfter(*this->access(index - 1), std::forward<Args>(args)...);
+    }
 
-        if (first_ == &block)
-        {
-            first_ = newBlock;
-        }
-        return *newBlock;
+    template<typename BlockType>
+    template<typename... Args>
+    BlockType& ExplicitSequence<BlockType>::emplaceAfter(BlockType& block, Args&&... args)
+    {
+        return this->linkAfter(block, AMS<BlockType>::memoryManager_->emplaceMemory(std::in_place, std::forward<Args>(args)...));
+    }
+
+    template<typename BlockType>
+    template<typename... Args>
+    BlockType& ExplicitSequence<BlockType>::emplaceBefore(BlockType& block, Args&&... args)
+    {
+        return this->linkBefore(block, AMS<BlockType>::memoryManager_->emplaceMemory(std::in_place, std::forward<Args>(args)...));
     }
 
     template<typename BlockType>
@@ -463,6 +487,64 @@ namespace ds::amt {
         block->next_ = nullptr;
     }
 
+    template<typename BlockType>
+    BlockType& ExplicitSequence<BlockType>::linkFirst(BlockType* newBlock)
+    {
+        if (first_ == nullptr)
+        {
+            first_ = last_ = newBlock;
+            return *newBlock;
+        }
+        else
+        {
+            return this->linkBefore(*first_, newBlock);
+        }
+    }
+
+    template<typename BlockType>
+    BlockType& ExplicitSequence<BlockType>::linkLast(BlockType* newBlock)
+    {
+        if (last_ == nullptr)
+        {
+            first_ = last_ = newBlock;
+            return *newBlock;
+        }
+        else
+        {
+            return this->linkAfter(*last_, newBlock);
+        }
+    }
+
+    template<typename BlockType>
+    BlockType& ExplicitSequence<BlockType>::linkAfter(BlockType& block, BlockType* newBlock)
+    {
+        BlockType* nextBlock = this->accessNext(block);
+
+        this->connectBlocks(&block, newBlock);
+        this->connectBlocks(newBlock, nextBlock);
+
+        if (last_ == &block)
+        {
+            last_ = newBlock;
+        }
+        return *newBlock;
+    }
+
+    template<typename BlockType>
+    BlockType& ExplicitSequence<BlockType>::linkBefore(BlockType& block, BlockType* newBlock)
+    {
+        BlockType* prevBlock = this->accessPrevious(block);
+
+        this->connectBlocks(prevBlock, newBlock);
+        this->connectBlocks(newBlock, &block);
+
+        if (first_ == &block)
+        {
+            first_ = newBlock;
+        }
+        return *newBlock;
+    }
+
     template <typename BlockType>
     ExplicitSequence<BlockType>::ExplicitSequenceIterator::ExplicitSequenceIterator(BlockType* position) :
         position_(position)
@@ -565,4 +647,4 @@ namespace ds::amt {
         block->previous_ = nullptr;
     }
 
-}
\ No newline at end of file
+}
\ No newline at end of file
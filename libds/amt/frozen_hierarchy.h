@@ -0,0 +1,325 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/hierarchy.h>
+#include <functional>
+
+namespace ds::amt {
+
+	template<typename DataType>
+	struct FrozenHierarchyBlock :
+		public MemoryBlock<DataType>
+	{
+		size_t parent_;
+		size_t subtreeSize_;
+		size_t level_;
+		size_t degree_;
+	};
+
+	/**
+	 * @brief Immutable snapshot of a hierarchy stored as a pre-order array.
+	 *
+	 * Each node knows the index of its parent, the size of its subtree and its level.
+	 * The subtree of a node therefore occupies the contiguous slice starting at the node,
+	 * so nodeCount, level and isAncestor are O(1) and processPreOrder is a linear scan.
+	 * The structure of the snapshot can't be modified, only the data of its nodes.
+	 */
+	template<typename DataType>
+	class FrozenHierarchy :
+		virtual public Hierarchy<FrozenHierarchyBlock<DataType>>,
+		public AMS<FrozenHierarchyBlock<DataType>>
+	{
+	public:
+		using BlockType = FrozenHierarchyBlock<DataType>;
+		using MemoryManagerType = mm::CompactMemoryManager<BlockType>;
+
+		FrozenHierarchy();
+		FrozenHierarchy(const FrozenHierarchy& other);
+		template<typename OtherBlockType>
+		explicit FrozenHierarchy(const Hierarchy<OtherBlockType>& other);
+
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		bool equals(const AMT& other) override;
+
+		size_t level(const BlockType& node) const override;
+		size_t degree(const BlockType& node) const override;
+		size_t nodeCount() const override;
+		size_t nodeCount(const BlockType& node) const override;
+
+		BlockType* accessRoot() const override;
+		BlockType* accessParent(const BlockType& node) const override;
+		BlockType* accessSon(const BlockType& node, size_t sonOrder) const override;
+		BlockType* accessNextSon(const BlockType& node, const BlockType* son, size_t& sonOrder) const override;
+
+		BlockType& emplaceRoot() override; // throw(unavailable_function_call)
+		void changeRoot(BlockType* newRoot) override; // throw(unavailable_function_call)
+
+		BlockType& emplaceSon(BlockType& parent, size_t sonOrder) override; // throw(unavailable_function_call)
+		void changeSon(BlockType& parent, size_t sonOrder, BlockType* newSon) override; // throw(unavailable_function_call)
+		void removeSon(BlockType& parent, size_t sonOrder) override; // throw(unavailable_function_call)
+
+		bool isAncestor(const BlockType& ancestor, const BlockType& node) const;
+		size_t calculateIndex(const BlockType& node) const;
+		BlockType* accessAt(size_t index) const;
+
+		void processPreOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const;
+
+	protected:
+		MemoryManagerType* getMemoryManager() const;
+
+	private:
+		template<typename OtherBlockType>
+		void build(const Hierarchy<OtherBlockType>& other);
+	};
+
+	template<typename BlockType>
+	FrozenHierarchy<typename BlockType::DataT> freeze(const Hierarchy<BlockType>& hierarchy);
+
+	//----------
+
+	template<typename DataType>
+	FrozenHierarchy<DataType>::FrozenHierarchy() :
+		AMS<BlockType>(new MemoryManagerType())
+	{
+	}
+
+	template<typename DataType>
+	FrozenHierarchy<DataType>::FrozenHierarchy(const FrozenHierarchy& other) :
+		AMS<BlockType>(new MemoryManagerType(*other.getMemoryManager()))
+	{
+	}
+
+	template<typename DataType>
+	template<typename OtherBlockType>
+	FrozenHierarchy<DataType>::FrozenHierarchy(const Hierarchy<OtherBlockType>& other) :
+		FrozenHierarchy()
+	{
+		this->build(other);
+	}
+
+	template<typename DataType>
+	AMT& FrozenHierarchy<DataType>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			const FrozenHierarchy<DataType>& otherHierarchy = dynamic_cast<const FrozenHierarchy<DataType>&>(other);
+			this->getMemoryManager()->assign(*otherHierarchy.getMemoryManager());
+		}
+
+		return *this;
+	}
+
+	template<typename DataType>
+	void FrozenHierarchy<DataType>::clear()
+	{
+		this->getMemoryManager()->clear();
+	}
+
+	template<typename DataType>
+	bool FrozenHierarchy<DataType>::equals(const AMT& other)
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		const FrozenHierarchy<DataType>* otherHierarchy = dynamic_cast<const FrozenHierarchy<DataType>*>(&other);
+		if (otherHierarchy == nullptr || this->size() != otherHierarchy->size())
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < this->size(); ++i)
+		{
+			const BlockType& myBlock = this->getMemoryManager()->getBlockAt(i);
+			const BlockType& otherBlock = otherHierarchy->getMemoryManager()->getBlockAt(i);
+			if (myBlock.parent_ != otherBlock.parent_ || !(myBlock.data_ == otherBlock.data_))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename DataType>
+	size_t FrozenHierarchy<DataType>::level(const BlockType& node) const
+	{
+		return node.level_;
+	}
+
+	template<typename DataType>
+	size_t FrozenHierarchy<DataType>::degree(const BlockType& node) const
+	{
+		return node.degree_;
+	}
+
+	template<typename DataType>
+	size_t FrozenHierarchy<DataType>::nodeCount() const
+	{
+		return this->size();
+	}
+
+	template<typename DataType>
+	size_t FrozenHierarchy<DataType>::nodeCount(const BlockType& node) const
+	{
+		return node.subtreeSize_;
+	}
+
+	template<typename DataType>
+	auto FrozenHierarchy<DataType>::accessRoot() const -> BlockType*
+	{
+		return this->accessAt(0);
+	}
+
+	template<typename DataType>
+	auto FrozenHierarchy<DataType>::accessParent(const BlockType& node) const -> BlockType*
+	{
+		return node.parent_ != INVALID_INDEX
+			? &this->getMemoryManager()->getBlockAt(node.parent_)
+			: nullptr;
+	}
+
+	template<typename DataType>
+	auto FrozenHierarchy<DataType>::accessSon(const BlockType& node, size_t sonOrder) const -> BlockType*
+	{
+		if (sonOrder >= node.degree_)
+		{
+			return nullptr;
+		}
+
+		size_t index = this->calculateIndex(node) + 1;
+		for (size_t i = 0; i < sonOrder; ++i)
+		{
+			index += this->getMemoryManager()->getBlockAt(index).subtreeSize_;
+		}
+		return &this->getMemoryManager()->getBlockAt(index);
+	}
+
+	template<typename DataType>
+	auto FrozenHierarchy<DataType>::accessNextSon(const BlockType& node, const BlockType* son, size_t& sonOrder) const -> BlockType*
+	{
+		++sonOrder;
+		return son == nullptr
+			? &this->getMemoryManager()->getBlockAt(this->calculateIndex(node) + 1)
+			: &this->getMemoryManager()->getBlockAt(this->calculateIndex(*son) + son->subtreeSize_);
+	}
+
+	template<typename DataType>
+	auto FrozenHierarchy<DataType>::emplaceRoot() -> BlockType&
+	{
+		throw unavailable_function_call("Method emplaceRoot() unavailable in frozen hierarchies!");
+	}
+
+	template<typename DataType>
+	void FrozenHierarchy<DataType>::changeRoot(BlockType*)
+	{
+		throw unavailable_function_call("Method changeRoot() unavailable in frozen hierarchies!");
+	}
+
+	template<typename DataType>
+	auto FrozenHierarchy<DataType>::emplaceSon(BlockType&, size_t) -> BlockType&
+	{
+		throw unavailable_function_call("Method emplaceSon() unavailable in frozen hierarchies!");
+	}
+
+	template<typename DataType>
+	void FrozenHierarchy<DataType>::changeSon(BlockType&, size_t, BlockType*)
+	{
+		throw unavailable_function_call("Method changeSon() unavailable in frozen hierarchies!");
+	}
+
+	template<typename DataType>
+	void FrozenHierarchy<DataType>::removeSon(BlockType&, size_t)
+	{
+		throw unavailable_function_call("Method removeSon() unavailable in frozen hierarchies!");
+	}
+
+	template<typename DataType>
+	bool FrozenHierarchy<DataType>::isAncestor(const BlockType& ancestor, const BlockType& node) const
+	{
+		const size_t ancestorIndex = this->calculateIndex(ancestor);
+		const size_t nodeIndex = this->calculateIndex(node);
+		return ancestorIndex < nodeIndex && nodeIndex < ancestorIndex + ancestor.subtreeSize_;
+	}
+
+	template<typename DataType>
+	size_t FrozenHierarchy<DataType>::calculateIndex(const BlockType& node) const
+	{
+		return this->getMemoryManager()->calculateIndex(node);
+	}
+
+	template<typename DataType>
+	auto FrozenHierarchy<DataType>::accessAt(size_t index) const -> BlockType*
+	{
+		return index < this->size()
+			? &this->getMemoryManager()->getBlockAt(index)
+			: nullptr;
+	}
+
+	template<typename DataType>
+	void FrozenHierarchy<DataType>::processPreOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const
+	{
+		if (node != nullptr)
+		{
+			const BlockType* end = node + node->subtreeSize_;
+			for (const BlockType* current = node; current != end; ++current)
+			{
+				operation(current);
+			}
+		}
+	}
+
+	template<typename DataType>
+	auto FrozenHierarchy<DataType>::getMemoryManager() const -> MemoryManagerType*
+	{
+		return static_cast<MemoryManagerType*>(this->memoryManager_);
+	}
+
+	template<typename DataType>
+	template<typename OtherBlockType>
+	void FrozenHierarchy<DataType>::build(const Hierarchy<OtherBlockType>& other)
+	{
+		MemoryManagerType* memoryManager = this->getMemoryManager();
+
+		std::function<void(const OtherBlockType*, size_t, size_t)> emit;
+		emit = [&](const OtherBlockType* otherNode, size_t parentIndex, size_t level)
+		{
+			const size_t index = this->size();
+			const size_t sonCount = other.degree(*otherNode);
+			{
+				// The reference is only valid until the next allocation.
+				BlockType& block = *memoryManager->allocateMemory();
+				block.data_ = otherNode->data_;
+				block.parent_ = parentIndex;
+				block.level_ = level;
+				block.degree_ = sonCount;
+			}
+
+			size_t sonOrder = INVALID_INDEX;
+			const OtherBlockType* otherSon = nullptr;
+			for (size_t i = 0; i < sonCount; ++i)
+			{
+				otherSon = other.accessNextSon(*otherNode, otherSon, sonOrder);
+				emit(otherSon, index, level + 1);
+			}
+
+			memoryManager->getBlockAt(index).subtreeSize_ = this->size() - index;
+		};
+
+		memoryManager->clear();
+		if (other.accessRoot() != nullptr)
+		{
+			emit(other.accessRoot(), INVALID_INDEX, 0);
+		}
+	}
+
+	//----------
+
+	template<typename BlockType>
+	FrozenHierarchy<typename BlockType::DataT> freeze(const Hierarchy<BlockType>& hierarchy)
+	{
+		return FrozenHierarchy<typename BlockType::DataT>(hierarchy);
+	}
+
+}
@@ -0,0 +1,485 @@
+#pragma once
+
+#include <libds/amt/abstract_memory_type.h>
+#include <libds/amt/network.h>
+#include <libds/amt/explicit_network.h>
+#include <unordered_map>
+
+namespace ds::amt {
+
+	template<typename DataType>
+	struct FrozenNetworkBlock :
+		public MemoryBlock<DataType>
+	{
+		size_t relationsOffset_;
+		size_t degree_;
+	};
+
+	/**
+	 * @brief Immutable snapshot of an explicit network in compressed sparse row form.
+	 *
+	 * Nodes are stored in one contiguous array in the order of the original gate.
+	 * Relations of all nodes are stored as indices of their targets in a second contiguous array,
+	 * node i owns the slice [relationsOffset_, relationsOffset_ + degree_) of it.
+	 * Every node remembers the node of the original network it was created from.
+	 * The structure of the snapshot can't be modified, only the data of its nodes.
+	 */
+	template<typename SourceBlockType>
+	class FrozenNetwork :
+		public Network<FrozenNetworkBlock<typename SourceBlockType::DataT>>,
+		public AMS<FrozenNetworkBlock<typename SourceBlockType::DataT>>
+	{
+	public:
+		using DataType = typename SourceBlockType::DataT;
+		using BlockType = FrozenNetworkBlock<DataType>;
+		using MemoryManagerType = mm::CompactMemoryManager<BlockType>;
+		using RelationsManagerType = mm::CompactMemoryManager<MemoryBlock<size_t>>;
+		using SourcesManagerType = mm::CompactMemoryManager<MemoryBlock<SourceBlockType*>>;
+
+		FrozenNetwork();
+		FrozenNetwork(const FrozenNetwork& other);
+		template<typename GateType>
+		explicit FrozenNetwork(const ExplicitNetwork<SourceBlockType, GateType>& other);
+		~FrozenNetwork() override;
+
+		AMT& assign(const AMT& other) override;
+		void clear() override;
+		bool equals(const AMT& other) override;
+
+		size_t relationCount() const override;
+		size_t degree(const BlockType& node) const override;
+
+		BlockType* accessNodeFromGate(size_t order) const override;
+		BlockType* accessNodeFromNode(const BlockType& node, size_t order) const override;
+
+		bool relationExists(const BlockType& nodeA, const BlockType& nodeB) const override;
+
+		BlockType& insert() override; // throw(unavailable_function_call)
+		void remove(BlockType* node) override; // throw(unavailable_function_call)
+
+		void connect(BlockType& nodeA, BlockType& nodeB) override; // throw(unavailable_function_call)
+		void disconnect(BlockType& nodeA, BlockType& nodeB) override; // throw(unavailable_function_call)
+
+		size_t calculateIndex(const BlockType& node) const;
+		size_t calculateRelationIndex(const BlockType& node, size_t order) const;
+		BlockType* accessAt(size_t index) const;
+		SourceBlockType* accessSource(const BlockType& node) const;
+
+	protected:
+		MemoryManagerType* getMemoryManager() const;
+
+	private:
+		template<typename GateType>
+		void build(const ExplicitNetwork<SourceBlockType, GateType>& other);
+
+		RelationsManagerType* relations_;
+		SourcesManagerType* sources_;
+
+	public:
+		class NodeIterator
+		{
+		public:
+			explicit NodeIterator(BlockType* position);
+			NodeIterator(const NodeIterator& other);
+			NodeIterator& operator++();
+			NodeIterator operator++(int);
+			bool operator==(const NodeIterator& other) const;
+			bool operator!=(const NodeIterator& other) const;
+			BlockType* operator*();
+
+		private:
+			BlockType* position_;
+		};
+
+		class RelationIterator
+		{
+		public:
+			RelationIterator(const FrozenNetwork* network, size_t position);
+			RelationIterator(const RelationIterator& other);
+			RelationIterator& operator++();
+			RelationIterator operator++(int);
+			bool operator==(const RelationIterator& other) const;
+			bool operator!=(const RelationIterator& other) const;
+			BlockType* operator*();
+
+		private:
+			const FrozenNetwork* network_;
+			size_t position_;
+		};
+
+		NodeIterator begin() const;
+		NodeIterator end() const;
+
+		RelationIterator beginRelations(const BlockType& node) const;
+		RelationIterator endRelations(const BlockType& node) const;
+
+		using IteratorType = NodeIterator;
+	};
+
+	template<typename BlockType, typename GateType>
+	FrozenNetwork<BlockType> freeze(const ExplicitNetwork<BlockType, GateType>& network);
+
+	//----------
+
+	template<typename SourceBlockType>
+	FrozenNetwork<SourceBlockType>::FrozenNetwork() :
+		AMS<BlockType>(new MemoryManagerType()),
+		relations_(new RelationsManagerType()),
+		sources_(new SourcesManagerType())
+	{
+	}
+
+	template<typename SourceBlockType>
+	FrozenNetwork<SourceBlockType>::FrozenNetwork(const FrozenNetwork& other) :
+		AMS<BlockType>(new MemoryManagerType(*other.getMemoryManager())),
+		relations_(new RelationsManagerType(*other.relations_)),
+		sources_(new SourcesManagerType(*other.sources_))
+	{
+	}
+
+	template<typename SourceBlockType>
+	template<typename GateType>
+	FrozenNetwork<SourceBlockType>::FrozenNetwork(const ExplicitNetwork<SourceBlockType, GateType>& other) :
+		FrozenNetwork()
+	{
+		this->build(other);
+	}
+
+	template<typename SourceBlockType>
+	FrozenNetwork<SourceBlockType>::~FrozenNetwork()
+	{
+		delete relations_;
+		relations_ = nullptr;
+		delete sources_;
+		sources_ = nullptr;
+	}
+
+	template<typename SourceBlockType>
+	AMT& FrozenNetwork<SourceBlockType>::assign(const AMT& other)
+	{
+		if (this != &other)
+		{
+			const FrozenNetwork<SourceBlockType>& otherNetwork = dynamic_cast<const FrozenNetwork<SourceBlockType>&>(other);
+			this->getMemoryManager()->assign(*otherNetwork.getMemoryManager());
+			relations_->assign(*otherNetwork.relations_);
+			sources_->assign(*otherNetwork.sources_);
+		}
+
+		return *this;
+	}
+
+	template<typename SourceBlockType>
+	void FrozenNetwork<SourceBlockType>::clear()
+	{
+		this->getMemoryManager()->clear();
+		relations_->clear();
+		sources_->clear();
+	}
+
+	template<typename SourceBlockType>
+	bool FrozenNetwork<SourceBlockType>::equals(const AMT& other)
+	{
+		if (this == &other)
+		{
+			return true;
+		}
+
+		const FrozenNetwork<SourceBlockType>* otherNetwork = dynamic_cast<const FrozenNetwork<SourceBlockType>*>(&other);
+		if (otherNetwork == nullptr || this->size() != otherNetwork->size() || this->relationCount() != otherNetwork->relationCount())
+		{
+			return false;
+		}
+
+		for (size_t i = 0; i < this->size(); ++i)
+		{
+			const BlockType& myBlock = this->getMemoryManager()->getBlockAt(i);
+			const BlockType& otherBlock = otherNetwork->getMemoryManager()->getBlockAt(i);
+			if (myBlock.degree_ != otherBlock.degree_ || !(myBlock.data_ == otherBlock.data_))
+			{
+				return false;
+			}
+		}
+
+		for (size_t i = 0; i < this->relationCount(); ++i)
+		{
+			if (relations_->getBlockAt(i).data_ != otherNetwork->relations_->getBlockAt(i).data_)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<typename SourceBlockType>
+	size_t FrozenNetwork<SourceBlockType>::relationCount() const
+	{
+		return relations_->getAllocatedBlockCount();
+	}
+
+	template<typename SourceBlockType>
+	size_t FrozenNetwork<SourceBlockType>::degree(const BlockType& node) const
+	{
+		return node.degree_;
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::accessNodeFromGate(size_t order) const -> BlockType*
+	{
+		return this->accessAt(order);
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::accessNodeFromNode(const BlockType& node, size_t order) const -> BlockType*
+	{
+		return order < node.degree_
+			? &this->getMemoryManager()->getBlockAt(this->calculateRelationIndex(node, order))
+			: nullptr;
+	}
+
+	template<typename SourceBlockType>
+	bool FrozenNetwork<SourceBlockType>::relationExists(const BlockType& nodeA, const BlockType& nodeB) const
+	{
+		const BlockType& nodeFrom = nodeA.degree_ <= nodeB.degree_ ? nodeA : nodeB;
+		const size_t indexTo = this->calculateIndex(nodeA.degree_ <= nodeB.degree_ ? nodeB : nodeA);
+		for (size_t i = 0; i < nodeFrom.degree_; ++i)
+		{
+			if (relations_->getBlockAt(nodeFrom.relationsOffset_ + i).data_ == indexTo)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::insert() -> BlockType&
+	{
+		throw unavailable_function_call("Method insert() unavailable in frozen networks!");
+	}
+
+	template<typename SourceBlockType>
+	void FrozenNetwork<SourceBlockType>::remove(BlockType*)
+	{
+		throw unavailable_function_call("Method remove() unavailable in frozen networks!");
+	}
+
+	template<typename SourceBlockType>
+	void FrozenNetwork<SourceBlockType>::connect(BlockType&, BlockType&)
+	{
+		throw unavailable_function_call("Method connect() unavailable in frozen networks!");
+	}
+
+	template<typename SourceBlockType>
+	void FrozenNetwork<SourceBlockType>::disconnect(BlockType&, BlockType&)
+	{
+		throw unavailable_function_call("Method disconnect() unavailable in frozen networks!");
+	}
+
+	template<typename SourceBlockType>
+	size_t FrozenNetwork<SourceBlockType>::calculateIndex(const BlockType& node) const
+	{
+		return this->getMemoryManager()->calculateIndex(node);
+	}
+
+	template<typename SourceBlockType>
+	size_t FrozenNetwork<SourceBlockType>::calculateRelationIndex(const BlockType& node, size_t order) const
+	{
+		return relations_->getBlockAt(node.relationsOffset_ + order).data_;
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::accessAt(size_t index) const -> BlockType*
+	{
+		return index < this->size()
+			? &this->getMemoryManager()->getBlockAt(index)
+			: nullptr;
+	}
+
+	template<typename SourceBlockType>
+	SourceBlockType* FrozenNetwork<SourceBlockType>::accessSource(const BlockType& node) const
+	{
+		return sources_->getBlockAt(this->calculateIndex(node)).data_;
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::getMemoryManager() const -> MemoryManagerType*
+	{
+		return static_cast<MemoryManagerType*>(this->memoryManager_);
+	}
+
+	template<typename SourceBlockType>
+	template<typename GateType>
+	void FrozenNetwork<SourceBlockType>::build(const ExplicitNetwork<SourceBlockType, GateType>& other)
+	{
+		MemoryManagerType* memoryManager = this->getMemoryManager();
+		memoryManager->clear();
+		relations_->clear();
+		sources_->clear();
+
+		if (other.isEmpty())
+		{
+			return;
+		}
+
+		std::unordered_map<const SourceBlockType*, size_t> indices;
+		indices.reserve(other.size());
+		memoryManager->changeCapacity(other.size());
+		sources_->changeCapacity(other.size());
+
+		size_t relationsOffset = 0;
+		for (SourceBlockType* otherNode : other)
+		{
+			BlockType& block = *memoryManager->allocateMemory();
+			block.data_ = otherNode->data_;
+			block.relationsOffset_ = relationsOffset;
+			block.degree_ = other.degree(*otherNode);
+			relationsOffset += block.degree_;
+
+			sources_->allocateMemory()->data_ = otherNode;
+			indices.emplace(otherNode, indices.size());
+		}
+
+		if (relationsOffset > 0)
+		{
+			relations_->changeCapacity(relationsOffset);
+		}
+		for (SourceBlockType* otherNode : other)
+		{
+			otherNode->relations_->processAllBlocksForward([&](typename SourceBlockType::RelationBlockType* b)
+				{
+					relations_->allocateMemory()->data_ = indices.at(b->data_);
+				});
+		}
+	}
+
+	//----------
+
+	template<typename SourceBlockType>
+	FrozenNetwork<SourceBlockType>::NodeIterator::NodeIterator(BlockType* position) :
+		position_(position)
+	{
+	}
+
+	template<typename SourceBlockType>
+	FrozenNetwork<SourceBlockType>::NodeIterator::NodeIterator(const NodeIterator& other) :
+		position_(other.position_)
+	{
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::NodeIterator::operator++() -> NodeIterator&
+	{
+		++position_;
+		return *this;
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::NodeIterator::operator++(int) -> NodeIterator
+	{
+		NodeIterator tmp(*this);
+		this->operator++();
+		return tmp;
+	}
+
+	template<typename SourceBlockType>
+	bool FrozenNetwork<SourceBlockType>::NodeIterator::operator==(const NodeIterator& other) const
+	{
+		return position_ == other.position_;
+	}
+
+	template<typename SourceBlockType>
+	bool FrozenNetwork<SourceBlockType>::NodeIterator::operator!=(const NodeIterator& other) const
+	{
+		return position_ != other.position_;
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::NodeIterator::operator*() -> BlockType*
+	{
+		return position_;
+	}
+
+	//----------
+
+	template<typename SourceBlockType>
+	FrozenNetwork<SourceBlockType>::RelationIterator::RelationIterator(const FrozenNetwork* network, size_t position) :
+		network_(network),
+		position_(position)
+	{
+	}
+
+	template<typename SourceBlockType>
+	FrozenNetwork<SourceBlockType>::RelationIterator::RelationIterator(const RelationIterator& other) :
+		network_(other.network_),
+		position_(other.position_)
+	{
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::RelationIterator::operator++() -> RelationIterator&
+	{
+		++position_;
+		return *this;
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::RelationIterator::operator++(int) -> RelationIterator
+	{
+		RelationIterator tmp(*this);
+		this->operator++();
+		return tmp;
+	}
+
+	template<typename SourceBlockType>
+	bool FrozenNetwork<SourceBlockType>::RelationIterator::operator==(const RelationIterator& other) const
+	{
+		return network_ == other.network_ && position_ == other.position_;
+	}
+
+	template<typename SourceBlockType>
+	bool FrozenNetwork<SourceBlockType>::RelationIterator::operator!=(const RelationIterator& other) const
+	{
+		return !(*this == other);
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::RelationIterator::operator*() -> BlockType*
+	{
+		return &network_->getMemoryManager()->getBlockAt(network_->relations_->getBlockAt(position_).data_);
+	}
+
+	//----------
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::begin() const -> NodeIterator
+	{
+		return NodeIterator(this->accessAt(0));
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::end() const -> NodeIterator
+	{
+		return NodeIterator(this->isEmpty() ? nullptr : this->accessAt(0) + this->size());
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::beginRelations(const BlockType& node) const -> RelationIterator
+	{
+		return RelationIterator(this, node.relationsOffset_);
+	}
+
+	template<typename SourceBlockType>
+	auto FrozenNetwork<SourceBlockType>::endRelations(const BlockType& node) const -> RelationIterator
+	{
+		return RelationIterator(this, node.relationsOffset_ + node.degree_);
+	}
+
+	//----------
+
+	template<typename BlockType, typename GateType>
+	FrozenNetwork<BlockType> freeze(const ExplicitNetwork<BlockType, GateType>& network)
+	{
+		return FrozenNetwork<BlockType>(network);
+	}
+
+}
@@ -19,6 +19,7 @@ namespace ds::amt {
 		virtual BlockType* accessRoot() const = 0;
 		virtual BlockType* accessParent(const BlockType& node) const = 0;
 		virtual BlockType* accessSon(const BlockType& node, size_t sonOrder) const = 0;
+		virtual BlockType* accessNextSon(const BlockType& node, const BlockType* son, size_t& sonOrder) const;
 
 		virtual bool isRoot(const BlockType& node) const;
 		virtual bool isNthSon(const BlockType& node, size_t sonOrder) const;
@@ -249,6 +250,18 @@ namespace ds::amt {
 		return this->accessSon(node, sonOrder) != nullptr;
 	}
 
+	template<typename BlockType>
+    BlockType* Hierarchy<BlockType>::accessNextSon(const BlockType& node, const BlockType*, size_t& sonOrder) const
+	{
+		BlockType* nextSon = nullptr;
+		do
+		{
+			++sonOrder;
+			nextSon = this->accessSon(node, sonOrder);
+		} while (nextSon == nullptr);
+		return nextSon;
+	}
+
 	template<typename BlockType>
     void Hierarchy<BlockType>::processPreOrder(const BlockType* node, std::function<void(const BlockType*)> operation) const
 	{
@@ -257,17 +270,12 @@ namespace ds::amt {
 			operation(node);
 
 		    size_t deg = this->degree(*node);
-			size_t sonsProcessed = 0;
-			size_t n = 0;
-			while (sonsProcessed < deg)
+			size_t sonOrder = INVALID_INDEX;
+			BlockType* son = nullptr;
+			for (size_t i = 0; i < deg; ++i)
 			{
-				BlockType* son = this->accessSon(*node, n);
-				if (son != nullptr)
-				{
-					this->processPreOrder(son, operation);
-					++sonsProcessed;
-				}
-				++n;
+				son = this->accessNextSon(*node, son, sonOrder);
+				this->processPreOrder(son, operation);
 			}
 		}
 	}
@@ -278,17 +286,14 @@ namespace ds::amt {
 		if (node != nullptr)
 		{
 			size_t deg = this->degree(*node);
-			size_t sonsProcessed = 0;
-			size_t n = 0;
-			while (sonsProcessed < deg)
+			size_t sonOrder = INVALID_INDEX;
+			BlockType* son = deg > 0 ? this->accessNextSon(*node, nullptr, sonOrder) : nullptr;
+			for (size_t i = 1; i <= deg; ++i)
 			{
-				BlockType* son = this->accessSon(*node, n);
-				if (son != nullptr)
-				{
-					this->processPostOrder(son, operation);
-					++sonsProcessed;
-				}
-				++n;
+				// the next son has to be found before the operation is allowed to release the current one
+				BlockType* nextSon = i < deg ? this->accessNextSon(*node, son, sonOrder) : nullptr;
+				this->processPostOrder(son, operation);
+				son = nextSon;
 			}
 
 			operation(node);
@@ -310,17 +315,12 @@ namespace ds::amt {
 				{
 					operation(current);
 					size_t nodeDegree = this->degree(*current);
-					size_t n = 0;
-					size_t sonsProcessed = 0;
-					while (sonsProcessed < nodeDegree)
+					size_t sonOrder = INVALID_INDEX;
+					BlockType* son = nullptr;
+					for (size_t i = 0; i < nodeDegree; ++i)
 					{
-						BlockType* son = this->accessSon(*current, n);
-						if (son != nullptr)
-						{
-							sequence.insertLast().data_ = son;
-							++sonsProcessed;
-						}
-						++n;
+						son = this->accessNextSon(*current, son, sonOrder);
+						sequence.insertLast().data_ = son;
 					}
 				}
 			}
@@ -443,11 +443,9 @@ namespace ds::amt {
 		size_t currentDegree = hierarchy_->degree(*currentPosition_->currentNode_);
 		if (currentPosition_->visitedSonCount_ <= currentDegree)
 		{
-			do
-			{
-				++currentPosition_->currentSonOrder_;
-				currentPosition_->currentSon_ = hierarchy_->accessSon(*currentPosition_->currentNode_, currentPosition_->currentSonOrder_);
-			} while (currentPosition_->currentSon_ == nullptr);
+			currentPosition_->currentSon_ = hierarchy_->accessNextSon(
+				*currentPosition_->currentNode_, currentPosition_->currentSon_, currentPosition_->currentSonOrder_
+			);
 			return true;
 		}
 		else
@@ -2,6 +2,7 @@
 
 #include <libds/amt/abstract_memory_type.h>
 #include <libds/amt/sequence.h>
+#include <libds/simd.h>
 
 namespace ds::amt {
 
@@ -27,12 +28,38 @@ namespace ds::amt {
         BlockType* accessNext(const BlockType& block) const override;
         BlockType* accessPrevious(const BlockType& block) const override;
 
+        /**
+         * @brief Accesses the block at @p index for reading only.
+         * Unlike access, it never detaches a copy-on-write buffer.
+         */
+        const BlockType* peek(size_t index) const;
+
+        /**
+         * @brief Index of the first block whose data equals @p data, INVALID_INDEX if there is none.
+         * Like the following methods, it scans the buffer with the simd kernels and never detaches it.
+         */
+        size_t indexOf(const DataType& data) const;
+        size_t countOf(const DataType& data) const;
+        size_t indexOfMin() const;
+        size_t indexOfMax() const;
+
         BlockType& insertFirst() override;
         BlockType& insertLast() override;
         BlockType& insert(size_t index) override;
         BlockType& insertAfter(BlockType& block) override;
         BlockType& insertBefore(BlockType& block) override;
 
+        template<typename... Args>
+        BlockType& emplaceFirst(Args&&... args);
+        template<typename... Args>
+        BlockType& emplaceLast(Args&&... args);
+        template<typename... Args>
+        BlockType& emplaceAt(size_t index, Args&&... args);
+        template<typename... Args>
+        BlockType& emplaceAfter(BlockType& block, Args&&... args);
+        template<typename... Args>
+        BlockType& emplaceBefore(BlockType& block, Args&&... args);
+
         void removeFirst() override;
         void removeLast() override;
         void remove(size_t index) override;
@@ -44,6 +71,9 @@ namespace ds::amt {
         virtual size_t indexOfNext(size_t currentIndex) const;
         virtual size_t indexOfPrevious(size_t currentIndex) const;
 
+    private:
+        const DataType* accessBuffer() const;
+
     public:
         class ImplicitSequenceIterator
         {
@@ -139,6 +169,37 @@ namespace ds::amt {
         return index != INVALID_INDEX ? &this->getMemoryManager()->getBlockAt(index) : nullptr;
     }
 
+    template<typename DataType>
+    auto ImplicitSequence<DataType>::peek(size_t index) const -> const BlockType*
+    {
+        const MemoryManagerType* memManager = this->getMemoryManager();
+        return index < this->size() ? &memManager->getBlockAt(index) : nullptr;
+    }
+
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::indexOf(const DataType& data) const
+    {
+        return simd::find(this->accessBuffer(), this->size(), data);
+    }
+
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::countOf(const DataType& data) const
+    {
+        return simd::count(this->accessBuffer(), this->size(), data);
+    }
+
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::indexOfMin() const
+    {
+        return simd::findMin(this->accessBuffer(), this->size());
+    }
+
+    template<typename DataType>
+    size_t ImplicitSequence<DataType>::indexOfMax() const
+    {
+        return simd::findMax(this->accessBuffer(), this->size());
+    }
+
     template<typename DataType>
     typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::insertFirst()
     {
@@ -172,6 +233,43 @@ namespace ds::amt {
 
     }
 
+    template<typename DataType>
+    template<typename... Args>
+    typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::emplaceFirst(Args&&... args)
+    {
+        return *this->getMemoryManager()->emplaceMemoryAt(0, std::in_place, std::forward<Args>(args)...);
+    }
+
+    template<typename DataType>
+    template<typename... Args>
+    typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::emplaceLast(Args&&... args)
+    {
+        return *this->getMemoryManager()->emplaceMemory(std::in_place, std::forward<Args>(args)...);
+    }
+
+    template<typename DataType>
+    template<typename... Args>
+    typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::emplaceAt(size_t index, Args&&... args)
+    {
+        return *this->getMemoryManager()->emplaceMemoryAt(index, std::in_place, std::forward<Args>(args)...);
+    }
+
+    template<typename DataType>
+    template<typename... Args>
+    typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::emplaceAfter(BlockType& block, Args&&... args)
+    {
+        MemoryManagerType* memManager = this->getMemoryManager();
+        return *memManager->emplaceMemoryAt(memManager->calculateIndex(block) + 1, std::in_place, std::forward<Args>(args)...);
+    }
+
+    template<typename DataType>
+    template<typename... Args>
+    typename ImplicitSequence<DataType>::BlockType& ImplicitSequence<DataType>::emplaceBefore(BlockType& block, Args&&... args)
+    {
+        MemoryManagerType* memManager = this->getMemoryManager();
+        return *memManager->emplaceMemoryAt(memManager->calculateIndex(block), std::in_place, std::forward<Args>(args)...);
+    }
+
     template<typename DataType>
     void ImplicitSequence<DataType>::removeFirst()
     {
@@ -222,6 +320,13 @@ namespace ds::amt {
         return currentIndex <= 0 ? INVALID_INDEX : currentIndex - 1;
     }
 
+    template<typename DataType>
+    const DataType* ImplicitSequence<DataType>::accessBuffer() const
+    {
+        static_assert(sizeof(BlockType) == sizeof(DataType), "Blocks must be laid out as a plain array of data.");
+        return this->isEmpty() ? nullptr : &this->peek(0)->data_;
+    }
+
     template <typename DataType>
     ImplicitSequence<DataType>::ImplicitSequenceIterator::ImplicitSequenceIterator
         (ImplicitSequence<DataType>* sequence, size_t index) :
@@ -311,4 +416,4 @@ namespace ds::amt {
         return size != 0 ? currentIndex <= 0 ? size - 1 : currentIndex - 1 : INVALID_INDEX;
     }
 
-}
\ No newline at end of file
+}
\ No newline at end of file
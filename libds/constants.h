@@ -6,4 +6,9 @@
 namespace ds
 {
     const size_t INVALID_INDEX = (std::numeric_limits<size_t>::max)();
+
+    /**
+     * @brief Alignment which keeps data written by different threads on separate cache lines.
+     */
+    constexpr size_t CACHE_LINE_SIZE = 64;
 }
\ No newline at end of file
@@ -1,12 +1,14 @@
 #pragma once
 
+#include <utility>
+
 /**
- * @brief Creates default-constructed object at @p address.
+ * @brief Creates object at @p address, constructed from @p args (value-initialized if there are none).
  */
-template<typename T>
-T* placement_new(T* address)
+template<typename T, typename... Args>
+T* placement_new(T* address, Args&&... args)
 {
-	return new (address) T();
+	return new (address) T(std::forward<Args>(args)...);
 }
 
 /**
@@ -4,6 +4,7 @@
 #include <libds/mm/memory_omanip.h>
 #include <libds/constants.h>
 #include <algorithm>
+#include <atomic>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -22,12 +23,37 @@ namespace ds::mm {
 
         BlockType* allocateMemory() override;
         BlockType* allocateMemoryAt(size_t index);
+
+        /**
+         * @brief Allocates a block at the end, constructed directly from @p args.
+         */
+        template<typename... Args>
+        BlockType* emplaceMemory(Args&&... args);
+
+        /**
+         * @brief Allocates a block at @p index, constructed directly from @p args.
+         * If the constructor throws, the manager is left unchanged.
+         */
+        template<typename... Args>
+        BlockType* emplaceMemoryAt(size_t index, Args&&... args);
         void releaseMemory(BlockType* pointer) override;
         void releaseMemoryAt(size_t index);
         void releaseMemory();
 
         size_t getCapacity() const;
 
+        /**
+         * @brief Enables or disables copy-on-write.
+         * Copies of a copy-on-write manager share its buffer in O(1) and take over the mode.
+         * The shared buffer is detached, i.e. copied, on the first mutating call of a sharer.
+         * Pointers to blocks obtained before the buffer was shared point into the shared buffer.
+         * The reference count is atomic, so copies sharing a buffer may be used from different
+         * threads. A single manager still may not.
+         */
+        void setCopyOnWrite(bool copyOnWrite);
+        bool isCopyOnWrite() const;
+        bool isShared() const;
+
         CompactMemoryManager<BlockType>& assign(const CompactMemoryManager<BlockType>& other);
         void changeCapacity(size_t newCapacity);
         void shrinkMemory();
@@ -36,6 +62,11 @@ namespace ds::mm {
         void* calculateAddress(const BlockType& data);
         size_t calculateIndex(const BlockType& data);
         BlockType& getBlockAt(size_t index);
+
+        /**
+         * @brief Reads the block at @p index without detaching a shared buffer.
+         */
+        const BlockType& getBlockAt(size_t index) const;
         void swap(size_t index1, size_t index2);
 
         void print(std::ostream& os);
@@ -44,11 +75,31 @@ namespace ds::mm {
         size_t getAllocatedBlocksSize() const;
         size_t getAllocatedCapacitySize() const;
 
+        BlockType* reserveBlockAt(size_t index);
+        void unreserveBlockAt(size_t index);
+
+        void shareBuffer(const CompactMemoryManager<BlockType>& other);
+        void releaseBuffer();
+        void detach();
+
+        /**
+         * @brief Gives the buffer its own reference count in copy-on-write mode, so that copies
+         * can share it without modifying the source.
+         */
+        void resetReferences();
+
     private:
         BlockType* base_;
         BlockType* end_;
         BlockType* limit_;
 
+        /**
+         * @brief Number of managers sharing the buffer, nullptr unless copy-on-write is enabled
+         * or the buffer is still shared.
+         */
+        std::atomic<size_t>* references_;
+        bool copyOnWrite_;
+
         static const size_t INIT_SIZE = 4;
     };
 
@@ -62,13 +113,19 @@ namespace ds::mm {
     CompactMemoryManager<BlockType>::CompactMemoryManager(size_t size) :
         base_(static_cast<BlockType*>(std::calloc(size, sizeof(BlockType)))),
         end_(base_),
-        limit_(base_ + size)
+        limit_(base_ + size),
+        references_(nullptr),
+        copyOnWrite_(false)
     {
     }
 
     template<typename BlockType>
     CompactMemoryManager<BlockType>::CompactMemoryManager(const CompactMemoryManager<BlockType>& other) :
-        CompactMemoryManager(other.getAllocatedBlockCount())
+        base_(nullptr),
+        end_(nullptr),
+        limit_(nullptr),
+        references_(nullptr),
+        copyOnWrite_(false)
     {
         this->assign(other);
     }
@@ -76,13 +133,8 @@ namespace ds::mm {
     template<typename BlockType>
     CompactMemoryManager<BlockType>::~CompactMemoryManager()
     {
-        // Ensures that destructor of each object is called.
-        CompactMemoryManager<BlockType>::releaseMemory(base_);
-        std::free(base_);
-
-        base_ = nullptr;
-        end_ = nullptr;
-        limit_ = nullptr;
+        // Ensures that destructor of each object is called, unless the buffer is still shared.
+        this->releaseBuffer();
     }
 
     template<typename BlockType>
@@ -94,29 +146,54 @@ namespace ds::mm {
     template<typename BlockType>
     BlockType* CompactMemoryManager<BlockType>::allocateMemoryAt(size_t index)
     {
-        if (end_ == limit_)
+        return this->emplaceMemoryAt(index);
+    }
+
+    template<typename BlockType>
+    template<typename... Args>
+    BlockType* CompactMemoryManager<BlockType>::emplaceMemory(Args&&... args)
+    {
+        return this->emplaceMemoryAt(static_cast<size_t>(end_ - base_), std::forward<Args>(args)...);
+    }
+
+    template<typename BlockType>
+    template<typename... Args>
+    BlockType* CompactMemoryManager<BlockType>::emplaceMemoryAt(size_t index, Args&&... args)
+    {
+        BlockType* block = this->reserveBlockAt(index);
+        try
         {
-            this->changeCapacity(2 * this->getAllocatedBlockCount());
+            return placement_new(block, std::forward<Args>(args)...);
         }
-
-        if (end_ - base_ > static_cast<std::ptrdiff_t>(index))
+        catch (...)
         {
-            std::memmove(
-                base_ + index + 1,
-                base_ + index,
-                (end_ - base_ - index) * sizeof(BlockType)
-            );
+            this->unreserveBlockAt(index);
+            throw;
         }
-
-        ++MemoryManager<BlockType>::allocatedBlockCount_;
-        ++end_;
-
-        return placement_new(base_ + index);
     }
 
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::releaseMemory(BlockType* pointer)
     {
+        if (this->isShared())
+        {
+            const size_t index = static_cast<size_t>(pointer - base_);
+            if (index == 0)
+            {
+                // Nothing would survive the copy, a fresh buffer is enough.
+                const size_t capacity = this->getCapacity();
+                this->releaseBuffer();
+                base_ = static_cast<BlockType*>(std::calloc(capacity, sizeof(BlockType)));
+                end_ = base_;
+                limit_ = base_ + capacity;
+                MemoryManager<BlockType>::allocatedBlockCount_ = 0;
+                this->resetReferences();
+                return;
+            }
+            this->detach();
+            pointer = base_ + index;
+        }
+
         BlockType* p = pointer;
         while (p != end_)
         {
@@ -131,14 +208,9 @@ namespace ds::mm {
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::releaseMemoryAt(size_t index)
     {
+        this->detach();
         destroy(&this->getBlockAt(index));
-        std::memmove(
-            base_ + index,
-            base_ + index + 1,
-            (end_ - base_ - index - 1) * sizeof(BlockType)
-        );
-        --end_;
-        --this->allocatedBlockCount_;
+        this->unreserveBlockAt(index);
     }
 
     template<typename BlockType>
@@ -153,15 +225,55 @@ namespace ds::mm {
         return limit_ - base_;
     }
 
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::setCopyOnWrite(bool copyOnWrite)
+    {
+        copyOnWrite_ = copyOnWrite;
+        if (!this->isShared())
+        {
+            delete references_;
+            this->resetReferences();
+        }
+    }
+
+    template<typename BlockType>
+    bool CompactMemoryManager<BlockType>::isCopyOnWrite() const
+    {
+        return copyOnWrite_;
+    }
+
+    template<typename BlockType>
+    bool CompactMemoryManager<BlockType>::isShared() const
+    {
+        return references_ != nullptr && *references_ > 1;
+    }
+
     template<typename BlockType>
     CompactMemoryManager<BlockType>& CompactMemoryManager<BlockType>::assign
     (const CompactMemoryManager<BlockType>& other)
     {
-        if (this != &other)
+        if (this != &other && (references_ == nullptr || references_ != other.references_))
         {
-            this->releaseMemory(base_);
+            copyOnWrite_ = other.copyOnWrite_;
+            if (copyOnWrite_)
+            {
+                this->releaseBuffer();
+                this->shareBuffer(other);
+                return *this;
+            }
+
+            if (this->isShared())
+            {
+                this->releaseBuffer();
+            }
+            else
+            {
+                this->releaseMemory(base_);
+                delete references_;
+                references_ = nullptr;
+            }
             this->allocatedBlockCount_ = other.MemoryManager<BlockType>::allocatedBlockCount_;
-            void* newBase = std::realloc(base_, other.getAllocatedCapacitySize());
+            void* newBase = std::realloc(static_cast<void*>(base_), other.getAllocatedCapacitySize());
             if (newBase == nullptr)
             {
                 throw std::bad_alloc();
@@ -199,12 +311,14 @@ namespace ds::mm {
             return;
         }
 
+        this->detach();
+
         if (newCapacity < this->getAllocatedBlockCount())
         {
             this->releaseMemory(base_ + newCapacity);
         }
 
-        void* newBase = std::realloc(base_, newCapacity * sizeof(BlockType));
+        void* newBase = std::realloc(static_cast<void*>(base_), newCapacity * sizeof(BlockType));
 
         if (newBase == nullptr)
         {
@@ -227,7 +341,8 @@ namespace ds::mm {
     {
         return this == &other ||
             this->getAllocatedBlockCount() == other.getAllocatedBlockCount() &&
-            std::memcmp(base_, other.base_, this->getAllocatedBlocksSize()) == 0;
+            (base_ == other.base_ ||
+            std::memcmp(base_, other.base_, this->getAllocatedBlocksSize()) == 0);
     }
 
     template<typename BlockType>
@@ -251,6 +366,13 @@ namespace ds::mm {
 
     template<typename BlockType>
     BlockType& CompactMemoryManager<BlockType>::getBlockAt(size_t index)
+    {
+        this->detach();
+        return *(base_ + index);
+    }
+
+    template<typename BlockType>
+    const BlockType& CompactMemoryManager<BlockType>::getBlockAt(size_t index) const
     {
         return *(base_ + index);
     }
@@ -258,6 +380,7 @@ namespace ds::mm {
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::swap(size_t index1, size_t index2)
     {
+        this->detach();
         std::swap(this->getBlockAt(index1), this->getBlockAt(index2));
     }
 
@@ -273,6 +396,113 @@ namespace ds::mm {
         return (limit_ - base_) * sizeof(BlockType);
     }
 
+    template<typename BlockType>
+    BlockType* CompactMemoryManager<BlockType>::reserveBlockAt(size_t index)
+    {
+        this->detach();
+        if (end_ == limit_)
+        {
+            this->changeCapacity(2 * this->getAllocatedBlockCount());
+        }
+
+        if (end_ - base_ > static_cast<std::ptrdiff_t>(index))
+        {
+            // Blocks are relocated bitwise by design, the casts to void* say so to the compiler.
+            std::memmove(
+                static_cast<void*>(base_ + index + 1),
+                base_ + index,
+                (end_ - base_ - index) * sizeof(BlockType)
+            );
+        }
+
+        ++MemoryManager<BlockType>::allocatedBlockCount_;
+        ++end_;
+
+        return base_ + index;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::unreserveBlockAt(size_t index)
+    {
+        std::memmove(
+            static_cast<void*>(base_ + index),
+            base_ + index + 1,
+            (end_ - base_ - index - 1) * sizeof(BlockType)
+        );
+        --end_;
+        --MemoryManager<BlockType>::allocatedBlockCount_;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::shareBuffer(const CompactMemoryManager<BlockType>& other)
+    {
+        // A copy-on-write source always has its reference count.
+        references_ = other.references_;
+        ++*references_;
+
+        base_ = other.base_;
+        end_ = other.end_;
+        limit_ = other.limit_;
+        this->allocatedBlockCount_ = other.MemoryManager<BlockType>::allocatedBlockCount_;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::releaseBuffer()
+    {
+        if (references_ != nullptr && --*references_ > 0)
+        {
+            references_ = nullptr;
+        }
+        else
+        {
+            delete references_;
+            references_ = nullptr;
+            this->releaseMemory(base_);
+            std::free(base_);
+        }
+
+        base_ = nullptr;
+        end_ = nullptr;
+        limit_ = nullptr;
+        this->allocatedBlockCount_ = 0;
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::detach()
+    {
+        if (!this->isShared())
+        {
+            return;
+        }
+
+        const size_t capacity = this->getCapacity();
+        const size_t blockCount = this->getAllocatedBlockCount();
+        BlockType* newBase = static_cast<BlockType*>(std::malloc(capacity * sizeof(BlockType)));
+        if (newBase == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        for (size_t i = 0; i < blockCount; ++i)
+        {
+            placement_copy(newBase + i, *(base_ + i));
+        }
+
+        // The other sharers may have released the buffer meanwhile, the last one frees it.
+        this->releaseBuffer();
+        base_ = newBase;
+        end_ = base_ + blockCount;
+        limit_ = base_ + capacity;
+        this->allocatedBlockCount_ = blockCount;
+        this->resetReferences();
+    }
+
+    template<typename BlockType>
+    void CompactMemoryManager<BlockType>::resetReferences()
+    {
+        references_ = copyOnWrite_ ? new std::atomic<size_t>(1) : nullptr;
+    }
+
     template<typename BlockType>
     void CompactMemoryManager<BlockType>::print(std::ostream& os)
     {
@@ -300,4 +530,4 @@ namespace ds::mm {
         os << limit_ << "|<- limit" << std::endl;
     }
 
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace ds::mm {
+
+    /**
+     * @brief Hazard pointers, a safe memory reclamation scheme for lock-free structures.
+     *
+     * Every thread owns a record with HAZARD_COUNT slots. A pointer published in a slot
+     * isn't freed until the slot is cleared. Retired pointers are freed in batches, once
+     * no slot of any thread holds them. A record of a finished thread is reused by the next
+     * new thread, together with its still protected retired pointers. Whatever is left is
+     * freed when the program exits.
+     */
+    class HazardPointers
+    {
+    public:
+        static const size_t HAZARD_COUNT = 2;
+
+        /**
+         * @brief Publishes the pointer stored in @p source in slot @p index of the calling thread.
+         * @return Published pointer, which can't be freed until the slot is cleared.
+         */
+        template<typename T>
+        static T* protect(size_t index, const std::atomic<T*>& source);
+
+        static void clear(size_t index);
+        static void clearAll();
+
+        /**
+         * @brief Deletes @p pointer once no thread protects it.
+         * The pointer must already be unreachable for threads which don't protect it.
+         */
+        template<typename T>
+        static void retire(T* pointer);
+
+        /**
+         * @brief Frees retired pointers of the calling thread which aren't protected anymore.
+         */
+        static void reclaim();
+
+    private:
+        struct Retired
+        {
+            void* pointer_;
+            void (*deleter_)(void*);
+        };
+
+        struct Record
+        {
+            std::atomic<bool> active_{ false };
+            std::atomic<void*> hazards_[HAZARD_COUNT] = {};
+            Record* next_ = nullptr;
+            std::vector<Retired> retired_;
+        };
+
+        class Domain
+        {
+        public:
+            ~Domain();
+            Record* acquire();
+            size_t getRecordCount() const;
+            Record* accessFirst() const;
+
+        private:
+            std::atomic<Record*> records_{ nullptr };
+            std::atomic<size_t> recordCount_{ 0 };
+        };
+
+        class Owner
+        {
+        public:
+            Owner();
+            ~Owner();
+            Record& accessRecord();
+
+        private:
+            Record* record_;
+        };
+
+        static Domain& getDomain();
+        static Record& getLocalRecord();
+        static void scan(Record& record);
+
+        static const size_t SCAN_THRESHOLD = 64;
+    };
+
+    //----------
+
+    template<typename T>
+    T* HazardPointers::protect(size_t index, const std::atomic<T*>& source)
+    {
+        std::atomic<void*>& hazard = getLocalRecord().hazards_[index];
+        T* pointer = source.load();
+        while (true)
+        {
+            hazard.store(pointer);
+            T* current = source.load();
+            if (current == pointer)
+            {
+                return pointer;
+            }
+            pointer = current;
+        }
+    }
+
+    inline void HazardPointers::clear(size_t index)
+    {
+        getLocalRecord().hazards_[index].store(nullptr, std::memory_order_release);
+    }
+
+    inline void HazardPointers::clearAll()
+    {
+        for (std::atomic<void*>& hazard : getLocalRecord().hazards_)
+        {
+            hazard.store(nullptr, std::memory_order_release);
+        }
+    }
+
+    template<typename T>
+    void HazardPointers::retire(T* pointer)
+    {
+        Record& record = getLocalRecord();
+        record.retired_.push_back({ pointer, [](void* p) { delete static_cast<T*>(p); } });
+        if (record.retired_.size() >= SCAN_THRESHOLD + 2 * HAZARD_COUNT * getDomain().getRecordCount())
+        {
+            scan(record);
+        }
+    }
+
+    inline void HazardPointers::reclaim()
+    {
+        scan(getLocalRecord());
+    }
+
+    inline auto HazardPointers::getDomain() -> Domain&
+    {
+        static Domain domain;
+        return domain;
+    }
+
+    inline auto HazardPointers::getLocalRecord() -> Record&
+    {
+        thread_local Owner owner;
+        return owner.accessRecord();
+    }
+
+    inline void HazardPointers::scan(Record& record)
+    {
+        std::vector<void*> hazards;
+        for (Record* r = getDomain().accessFirst(); r != nullptr; r = r->next_)
+        {
+            for (const std::atomic<void*>& hazard : r->hazards_)
+            {
+                void* pointer = hazard.load();
+                if (pointer != nullptr)
+                {
+                    hazards.push_back(pointer);
+                }
+            }
+        }
+        std::sort(hazards.begin(), hazards.end());
+
+        auto kept = std::partition(record.retired_.begin(), record.retired_.end(), [&hazards](const Retired& retired)
+            {
+                return std::binary_search(hazards.begin(), hazards.end(), retired.pointer_);
+            });
+        for (auto it = kept; it != record.retired_.end(); ++it)
+        {
+            it->deleter_(it->pointer_);
+        }
+        record.retired_.erase(kept, record.retired_.end());
+    }
+
+    //----------
+
+    inline HazardPointers::Domain::~Domain()
+    {
+        Record* record = records_.load();
+        while (record != nullptr)
+        {
+            for (const Retired& retired : record->retired_)
+            {
+                retired.deleter_(retired.pointer_);
+            }
+            Record* next = record->next_;
+            delete record;
+            record = next;
+        }
+    }
+
+    inline auto HazardPointers::Domain::acquire() -> Record*
+    {
+        for (Record* record = records_.load(); record != nullptr; record = record->next_)
+        {
+            bool expected = false;
+            if (!record->active_.load(std::memory_order_relaxed) && record->active_.compare_exchange_strong(expected, true))
+            {
+                return record;
+            }
+        }
+
+        Record* record = new Record();
+        record->active_.store(true, std::memory_order_relaxed);
+        record->next_ = records_.load();
+        while (!records_.compare_exchange_weak(record->next_, record))
+        {
+        }
+        recordCount_.fetch_add(1, std::memory_order_relaxed);
+        return record;
+    }
+
+    inline size_t HazardPointers::Domain::getRecordCount() const
+    {
+        return recordCount_.load(std::memory_order_relaxed);
+    }
+
+    inline auto HazardPointers::Domain::accessFirst() const -> Record*
+    {
+        return records_.load();
+    }
+
+    //----------
+
+    inline HazardPointers::Owner::Owner() :
+        record_(getDomain().acquire())
+    {
+    }
+
+    inline HazardPointers::Owner::~Owner()
+    {
+        for (std::atomic<void*>& hazard : record_->hazards_)
+        {
+            hazard.store(nullptr);
+        }
+        scan(*record_);
+        record_->active_.store(false, std::memory_order_release);
+        record_ = nullptr;
+    }
+
+    inline auto HazardPointers::Owner::accessRecord() -> Record&
+    {
+        return *record_;
+    }
+
+}
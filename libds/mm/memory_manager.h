@@ -1,7 +1,10 @@
 #pragma once
 
 #include <libds/heap_monitor.h>
+#include <cstdlib>
+#include <new>
 #include <uchar.h>
+#include <utility>
 
 namespace ds::mm {
 
@@ -14,11 +17,24 @@ public:
   virtual BlockType *allocateMemory();
   virtual void releaseMemory(BlockType *pointer);
 
+  /**
+   * @brief Allocates a block constructed directly from @p args.
+   */
+  template <typename... Args> BlockType *emplaceMemory(Args &&...args);
+
   void releaseAndSetNull(BlockType *&pointer);
 
   size_t getAllocatedBlockCount() const;
 
 protected:
+  /**
+   * @brief Uninitialized storage for one block, later handed back to
+   * releaseStorage. Comes straight from the heap unless a derived manager
+   * recycles it.
+   */
+  virtual BlockType *acquireStorage();
+  virtual void releaseStorage(BlockType *pointer);
+
   size_t allocatedBlockCount_;
 };
 
@@ -31,14 +47,28 @@ template <typename BlockType> MemoryManager<BlockType>::~MemoryManager() {
 
 template <typename BlockType>
 BlockType *MemoryManager<BlockType>::allocateMemory() {
+  return this->emplaceMemory();
+}
+
+template <typename BlockType>
+template <typename... Args>
+BlockType *MemoryManager<BlockType>::emplaceMemory(Args &&...args) {
+  BlockType *result = this->acquireStorage();
+  try {
+    placement_new(result, std::forward<Args>(args)...);
+  } catch (...) {
+    this->releaseStorage(result);
+    throw;
+  }
   allocatedBlockCount_++;
-  return new BlockType();
+  return result;
 }
 
 template <typename BlockType>
 void MemoryManager<BlockType>::releaseMemory(BlockType *pointer) {
   allocatedBlockCount_--;
-  delete pointer;
+  destroy(pointer);
+  this->releaseStorage(pointer);
 }
 
 template <typename BlockType>
@@ -51,4 +81,18 @@ template <typename BlockType>
 size_t MemoryManager<BlockType>::getAllocatedBlockCount() const {
   return allocatedBlockCount_;
 }
+
+template <typename BlockType>
+BlockType *MemoryManager<BlockType>::acquireStorage() {
+  void *storage = std::malloc(sizeof(BlockType));
+  if (storage == nullptr) {
+    throw std::bad_alloc();
+  }
+  return static_cast<BlockType *>(storage);
+}
+
+template <typename BlockType>
+void MemoryManager<BlockType>::releaseStorage(BlockType *pointer) {
+  std::free(pointer);
+}
 } // namespace ds::mm
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <libds/mm/memory_manager.h>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace ds::mm {
+
+    /**
+     * @brief Memory manager carving blocks out of large chunks instead of allocating each one from the heap.
+     *
+     * Released blocks are kept in a free list and handed out again first, so a structure that keeps
+     * inserting and removing nodes stops touching the heap once it reached its peak size, and blocks
+     * allocated one after another lie next to each other. Chunks grow geometrically up to MAX_CHUNK_SIZE
+     * blocks and are returned to the heap only when the manager is destroyed.
+     */
+    template<typename BlockType>
+    class PoolMemoryManager : public MemoryManager<BlockType> {
+    public:
+        PoolMemoryManager();
+        explicit PoolMemoryManager(size_t initChunkSize);
+        PoolMemoryManager(const PoolMemoryManager<BlockType>& other) = delete;
+        PoolMemoryManager<BlockType>& operator=(const PoolMemoryManager<BlockType>& other) = delete;
+        ~PoolMemoryManager() override;
+
+        /**
+         * @brief Number of blocks the chunks can hold, allocated or not.
+         */
+        size_t getCapacity() const;
+
+        static constexpr size_t INIT_CHUNK_SIZE = 32;
+        static constexpr size_t MAX_CHUNK_SIZE = 4096;
+
+    protected:
+        BlockType* acquireStorage() override;
+        void releaseStorage(BlockType* pointer) override;
+
+    private:
+        union Slot
+        {
+            Slot* next_;
+            alignas(BlockType) unsigned char block_[sizeof(BlockType)];
+        };
+
+        static_assert(alignof(Slot) <= alignof(std::max_align_t), "Chunks are aligned by malloc only.");
+
+        void allocateChunk();
+
+        // The first slot of every chunk links the previously allocated chunk.
+        Slot* chunks_;
+        Slot* freeSlots_;
+        Slot* nextSlot_;
+        Slot* chunkEnd_;
+        size_t nextChunkSize_;
+        size_t capacity_;
+    };
+
+    //----------
+
+    template<typename BlockType>
+    PoolMemoryManager<BlockType>::PoolMemoryManager() :
+        PoolMemoryManager(INIT_CHUNK_SIZE)
+    {
+    }
+
+    template<typename BlockType>
+    PoolMemoryManager<BlockType>::PoolMemoryManager(size_t initChunkSize) :
+        MemoryManager<BlockType>(),
+        chunks_(nullptr),
+        freeSlots_(nullptr),
+        nextSlot_(nullptr),
+        chunkEnd_(nullptr),
+        nextChunkSize_(initChunkSize > 0 ? initChunkSize : 1),
+        capacity_(0)
+    {
+    }
+
+    template<typename BlockType>
+    PoolMemoryManager<BlockType>::~PoolMemoryManager()
+    {
+        while (chunks_ != nullptr)
+        {
+            Slot* previous = chunks_->next_;
+            std::free(chunks_);
+            chunks_ = previous;
+        }
+        freeSlots_ = nullptr;
+        nextSlot_ = nullptr;
+        chunkEnd_ = nullptr;
+        capacity_ = 0;
+    }
+
+    template<typename BlockType>
+    size_t PoolMemoryManager<BlockType>::getCapacity() const
+    {
+        return capacity_;
+    }
+
+    template<typename BlockType>
+    BlockType* PoolMemoryManager<BlockType>::acquireStorage()
+    {
+        Slot* slot = freeSlots_;
+        if (slot != nullptr)
+        {
+            freeSlots_ = slot->next_;
+        }
+        else
+        {
+            if (nextSlot_ == chunkEnd_)
+            {
+                this->allocateChunk();
+            }
+            slot = nextSlot_++;
+        }
+        return reinterpret_cast<BlockType*>(slot->block_);
+    }
+
+    template<typename BlockType>
+    void PoolMemoryManager<BlockType>::releaseStorage(BlockType* pointer)
+    {
+        Slot* slot = reinterpret_cast<Slot*>(pointer);
+        slot->next_ = freeSlots_;
+        freeSlots_ = slot;
+    }
+
+    template<typename BlockType>
+    void PoolMemoryManager<BlockType>::allocateChunk()
+    {
+        const size_t chunkSize = nextChunkSize_;
+        Slot* chunk = static_cast<Slot*>(std::malloc((chunkSize + 1) * sizeof(Slot)));
+        if (chunk == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        chunk->next_ = chunks_;
+        chunks_ = chunk;
+        nextSlot_ = chunk + 1;
+        chunkEnd_ = nextSlot_ + chunkSize;
+        capacity_ += chunkSize;
+        nextChunkSize_ = chunkSize < MAX_CHUNK_SIZE ? chunkSize * 2 : chunkSize;
+    }
+}
@@ -0,0 +1,808 @@
+#pragma once
+
+#include <libds/constants.h>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// Kernels are vectorized on x86-64, where SSE2 is always available and AVX2 is detected at runtime.
+// Defining DS_NO_SIMD forces the scalar kernels everywhere.
+#if !defined(DS_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+#define DS_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define DS_TARGET_AVX2
+#else
+#define DS_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace ds::simd
+{
+    /**
+     * @brief Instruction sets the kernels can use, ordered from the narrowest.
+     */
+    enum class InstructionSet
+    {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    /**
+     * @brief Widest instruction set supported by this build and the running CPU.
+     */
+    InstructionSet detectInstructionSet();
+
+    /**
+     * @brief Instruction set currently used by the kernels, detected on first use.
+     */
+    InstructionSet getInstructionSet();
+
+    /**
+     * @brief Restricts the kernels to @p instructionSet, at most to the detected one.
+     * Meant for comparing the kernels with each other.
+     */
+    void setInstructionSet(InstructionSet instructionSet);
+
+    /**
+     * @brief Whether the kernels have a vectorized path for @p T.
+     * Other types use the scalar kernels, which only need == and <.
+     */
+    template<typename T>
+    inline constexpr bool is_vectorizable_v =
+        (std::is_integral_v<T> || std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_pointer_v<T>) &&
+        sizeof(T) <= 8;
+
+    /**
+     * @brief Index of the first of @p count elements at @p data equal to @p value, INVALID_INDEX if there is none.
+     */
+    template<typename T>
+    size_t find(const T* data, size_t count, const T& value);
+
+    /**
+     * @brief Number of the @p count elements at @p data equal to @p value.
+     */
+    template<typename T>
+    size_t count(const T* data, size_t count, const T& value);
+
+    /**
+     * @brief Index of the first smallest of @p count elements at @p data, INVALID_INDEX if @p count is 0.
+     * The result is unspecified if the elements contain NaN.
+     */
+    template<typename T>
+    size_t findMin(const T* data, size_t count);
+
+    /**
+     * @brief Index of the first largest of @p count elements at @p data, INVALID_INDEX if @p count is 0.
+     * The result is unspecified if the elements contain NaN.
+     */
+    template<typename T>
+    size_t findMax(const T* data, size_t count);
+
+    /**
+     * @brief Whether the @p count elements at @p data1 and @p data2 are pairwise equal.
+     */
+    template<typename T>
+    bool equal(const T* data1, const T* data2, size_t count);
+
+    /**
+     * @brief Index of the first of @p count elements equal to @p value, where the element i
+     * lives @p stride bytes after the element i - 1 and the element 0 at @p first.
+     * Used to search keys of items stored in a contiguous buffer.
+     */
+    template<typename T>
+    size_t findStrided(const T* first, size_t stride, size_t count, const T& value);
+
+    /**
+     * @brief Number of bytes matched at once by matchBytes and matchHighBits.
+     */
+    inline constexpr size_t BYTE_GROUP_SIZE = 16;
+
+    /**
+     * @brief Mask of the BYTE_GROUP_SIZE bytes at @p group equal to @p value, bit i stands for the byte i.
+     * Used to probe control bytes of open addressing tables.
+     */
+    unsigned int matchBytes(const std::uint8_t* group, std::uint8_t value);
+
+    /**
+     * @brief Mask of the BYTE_GROUP_SIZE bytes at @p group with the highest bit set, bit i stands for the byte i.
+     */
+    unsigned int matchHighBits(const std::uint8_t* group);
+
+    /**
+     * @brief Hints the CPU to load the cache line holding @p address, without waiting for it.
+     * Used by batched lookups to overlap the cache misses of several keys.
+     */
+    void prefetch(const void* address);
+
+    //----------
+
+    namespace details
+    {
+        inline InstructionSet& activeInstructionSet()
+        {
+            static InstructionSet instructionSet = detectInstructionSet();
+            return instructionSet;
+        }
+
+        inline size_t firstSetBit(unsigned int mask)
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return index;
+#else
+            return static_cast<size_t>(__builtin_ctz(mask));
+#endif
+        }
+
+        inline size_t setBitCount(unsigned int mask)
+        {
+            return std::bitset<32>(mask).count();
+        }
+
+        template<typename T>
+        const T& elementAt(const T* first, size_t stride, size_t index)
+        {
+            return *reinterpret_cast<const T*>(reinterpret_cast<const unsigned char*>(first) + index * stride);
+        }
+
+        //----------
+
+        template<typename T>
+        size_t findScalar(const T* data, size_t count, const T& value)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (data[i] == value)
+                {
+                    return i;
+                }
+            }
+            return INVALID_INDEX;
+        }
+
+        template<typename T>
+        size_t countScalar(const T* data, size_t count, const T& value)
+        {
+            size_t result = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                result += data[i] == value ? 1 : 0;
+            }
+            return result;
+        }
+
+        template<bool IsMax, typename T>
+        size_t findExtremeScalar(const T* data, size_t count)
+        {
+            if (count == 0)
+            {
+                return INVALID_INDEX;
+            }
+
+            size_t result = 0;
+            for (size_t i = 1; i < count; ++i)
+            {
+                if (IsMax ? data[result] < data[i] : data[i] < data[result])
+                {
+                    result = i;
+                }
+            }
+            return result;
+        }
+
+        template<typename T>
+        bool equalScalar(const T* data1, const T* data2, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!(data1[i] == data2[i]))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        inline unsigned int matchBytesScalar(const std::uint8_t* group, std::uint8_t value)
+        {
+            unsigned int mask = 0;
+            for (size_t i = 0; i < BYTE_GROUP_SIZE; ++i)
+            {
+                mask |= static_cast<unsigned int>(group[i] == value) << i;
+            }
+            return mask;
+        }
+
+        inline unsigned int matchHighBitsScalar(const std::uint8_t* group)
+        {
+            unsigned int mask = 0;
+            for (size_t i = 0; i < BYTE_GROUP_SIZE; ++i)
+            {
+                mask |= static_cast<unsigned int>(group[i] >> 7) << i;
+            }
+            return mask;
+        }
+
+        template<typename T>
+        size_t findStridedScalar(const T* first, size_t stride, size_t count, const T& value)
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (elementAt(first, stride, i) == value)
+                {
+                    return i;
+                }
+            }
+            return INVALID_INDEX;
+        }
+
+#ifdef DS_SIMD_X86
+
+        /**
+         * @brief Bits of @p value as an integer of the same size.
+         */
+        template<typename T>
+        auto bitsOf(const T& value)
+        {
+            using BitsType = std::conditional_t<sizeof(T) == 1, std::int8_t,
+                std::conditional_t<sizeof(T) == 2, std::int16_t,
+                std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>>>;
+            BitsType bits;
+            std::memcpy(&bits, &value, sizeof(T));
+            return bits;
+        }
+
+        //----------
+
+        template<typename T>
+        __m128i broadcastSse2(const T& value)
+        {
+            if constexpr (sizeof(T) == 1) { return _mm_set1_epi8(bitsOf(value)); }
+            else if constexpr (sizeof(T) == 2) { return _mm_set1_epi16(bitsOf(value)); }
+            else if constexpr (sizeof(T) == 4) { return _mm_set1_epi32(bitsOf(value)); }
+            else { return _mm_set1_epi64x(bitsOf(value)); }
+        }
+
+        /**
+         * @brief Lanes of @p a and @p b equal as @p T with all bits set, others cleared.
+         */
+        template<typename T>
+        __m128i equalLanesSse2(__m128i a, __m128i b)
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                return _mm_castps_si128(_mm_cmpeq_ps(_mm_castsi128_ps(a), _mm_castsi128_ps(b)));
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                return _mm_castpd_si128(_mm_cmpeq_pd(_mm_castsi128_pd(a), _mm_castsi128_pd(b)));
+            }
+            else if constexpr (sizeof(T) == 1) { return _mm_cmpeq_epi8(a, b); }
+            else if constexpr (sizeof(T) == 2) { return _mm_cmpeq_epi16(a, b); }
+            else if constexpr (sizeof(T) == 4) { return _mm_cmpeq_epi32(a, b); }
+            else
+            {
+                // SSE2 has no 64-bit comparison, both halves have to match.
+                const __m128i halves = _mm_cmpeq_epi32(a, b);
+                return _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+            }
+        }
+
+        /**
+         * @brief Byte mask of lanes equal to @p needle in 16 bytes at @p data.
+         */
+        template<typename T>
+        unsigned int equalMaskSse2(const T* data, __m128i needle)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            return static_cast<unsigned int>(_mm_movemask_epi8(equalLanesSse2<T>(block, needle)));
+        }
+
+        template<typename T>
+        size_t findSse2(const T* data, size_t count, const T& value)
+        {
+            constexpr size_t LANES = 16 / sizeof(T);
+            const __m128i needle = broadcastSse2(value);
+            size_t i = 0;
+            for (; i + LANES <= count; i += LANES)
+            {
+                const unsigned int mask = equalMaskSse2(data + i, needle);
+                if (mask != 0)
+                {
+                    return i + firstSetBit(mask) / sizeof(T);
+                }
+            }
+            const size_t rest = findScalar(data + i, count - i, value);
+            return rest == INVALID_INDEX ? INVALID_INDEX : i + rest;
+        }
+
+        inline unsigned int matchBytesSse2(const std::uint8_t* group, std::uint8_t value)
+        {
+            const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(group));
+            const __m128i needle = _mm_set1_epi8(static_cast<char>(value));
+            return static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+        }
+
+        inline unsigned int matchHighBitsSse2(const std::uint8_t* group)
+        {
+            return static_cast<unsigned int>(_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(group))));
+        }
+
+        template<typename T>
+        size_t countSse2(const T* data, size_t count, const T& value)
+        {
+            constexpr size_t LANES = 16 / sizeof(T);
+            const __m128i needle = broadcastSse2(value);
+            size_t result = 0;
+            size_t i = 0;
+            for (; i + LANES <= count; i += LANES)
+            {
+                result += setBitCount(equalMaskSse2(data + i, needle));
+            }
+            return result / sizeof(T) + countScalar(data + i, count - i, value);
+        }
+
+        template<typename T>
+        bool equalSse2(const T* data1, const T* data2, size_t count)
+        {
+            constexpr size_t LANES = 16 / sizeof(T);
+            size_t i = 0;
+            for (; i + LANES <= count; i += LANES)
+            {
+                const __m128i block1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data1 + i));
+                const __m128i block2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data2 + i));
+                if (_mm_movemask_epi8(equalLanesSse2<T>(block1, block2)) != 0xFFFF)
+                {
+                    return false;
+                }
+            }
+            return equalScalar(data1 + i, data2 + i, count - i);
+        }
+
+        template<typename T>
+        inline constexpr bool has_sse2_extreme_v =
+            std::is_same_v<T, float> || std::is_same_v<T, double> ||
+            std::is_same_v<T, std::int16_t> || std::is_same_v<T, std::uint8_t> || std::is_same_v<T, std::int32_t>;
+
+        template<bool IsMax, typename T>
+        __m128i extremeLanesSse2(__m128i a, __m128i b)
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const __m128 fa = _mm_castsi128_ps(a);
+                const __m128 fb = _mm_castsi128_ps(b);
+                return _mm_castps_si128(IsMax ? _mm_max_ps(fa, fb) : _mm_min_ps(fa, fb));
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                const __m128d da = _mm_castsi128_pd(a);
+                const __m128d db = _mm_castsi128_pd(b);
+                return _mm_castpd_si128(IsMax ? _mm_max_pd(da, db) : _mm_min_pd(da, db));
+            }
+            else if constexpr (std::is_same_v<T, std::int16_t>)
+            {
+                return IsMax ? _mm_max_epi16(a, b) : _mm_min_epi16(a, b);
+            }
+            else if constexpr (std::is_same_v<T, std::uint8_t>)
+            {
+                return IsMax ? _mm_max_epu8(a, b) : _mm_min_epu8(a, b);
+            }
+            else
+            {
+                // SSE2 has no 32-bit min/max, lanes are selected by a comparison.
+                const __m128i takeB = IsMax ? _mm_cmpgt_epi32(b, a) : _mm_cmpgt_epi32(a, b);
+                return _mm_or_si128(_mm_and_si128(takeB, b), _mm_andnot_si128(takeB, a));
+            }
+        }
+
+        template<bool IsMax, typename T>
+        size_t findExtremeSse2(const T* data, size_t count)
+        {
+            constexpr size_t LANES = 16 / sizeof(T);
+            if (count < LANES)
+            {
+                return findExtremeScalar<IsMax>(data, count);
+            }
+
+            __m128i extremes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+            size_t i = LANES;
+            for (; i + LANES <= count; i += LANES)
+            {
+                extremes = extremeLanesSse2<IsMax, T>(extremes, _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i)));
+            }
+
+            T lanes[LANES];
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), extremes);
+            T extreme = lanes[findExtremeScalar<IsMax>(lanes, LANES)];
+            for (; i < count; ++i)
+            {
+                if (IsMax ? extreme < data[i] : data[i] < extreme)
+                {
+                    extreme = data[i];
+                }
+            }
+            return findSse2(data, count, extreme);
+        }
+
+        //----------
+
+        template<typename T>
+        DS_TARGET_AVX2 __m256i broadcastAvx2(const T& value)
+        {
+            if constexpr (sizeof(T) == 1) { return _mm256_set1_epi8(bitsOf(value)); }
+            else if constexpr (sizeof(T) == 2) { return _mm256_set1_epi16(bitsOf(value)); }
+            else if constexpr (sizeof(T) == 4) { return _mm256_set1_epi32(bitsOf(value)); }
+            else { return _mm256_set1_epi64x(bitsOf(value)); }
+        }
+
+        template<typename T>
+        DS_TARGET_AVX2 __m256i equalLanesAvx2(__m256i a, __m256i b)
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                return _mm256_castps_si256(_mm256_cmp_ps(_mm256_castsi256_ps(a), _mm256_castsi256_ps(b), _CMP_EQ_OQ));
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                return _mm256_castpd_si256(_mm256_cmp_pd(_mm256_castsi256_pd(a), _mm256_castsi256_pd(b), _CMP_EQ_OQ));
+            }
+            else if constexpr (sizeof(T) == 1) { return _mm256_cmpeq_epi8(a, b); }
+            else if constexpr (sizeof(T) == 2) { return _mm256_cmpeq_epi16(a, b); }
+            else if constexpr (sizeof(T) == 4) { return _mm256_cmpeq_epi32(a, b); }
+            else { return _mm256_cmpeq_epi64(a, b); }
+        }
+
+        template<typename T>
+        DS_TARGET_AVX2 unsigned int equalMaskAvx2(const T* data, __m256i needle)
+        {
+            const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            return static_cast<unsigned int>(_mm256_movemask_epi8(equalLanesAvx2<T>(block, needle)));
+        }
+
+        template<typename T>
+        DS_TARGET_AVX2 size_t findAvx2(const T* data, size_t count, const T& value)
+        {
+            constexpr size_t LANES = 32 / sizeof(T);
+            const __m256i needle = broadcastAvx2(value);
+            size_t i = 0;
+            for (; i + LANES <= count; i += LANES)
+            {
+                const unsigned int mask = equalMaskAvx2(data + i, needle);
+                if (mask != 0)
+                {
+                    return i + firstSetBit(mask) / sizeof(T);
+                }
+            }
+            const size_t rest = findSse2(data + i, count - i, value);
+            return rest == INVALID_INDEX ? INVALID_INDEX : i + rest;
+        }
+
+        template<typename T>
+        DS_TARGET_AVX2 size_t countAvx2(const T* data, size_t count, const T& value)
+        {
+            constexpr size_t LANES = 32 / sizeof(T);
+            const __m256i needle = broadcastAvx2(value);
+            size_t result = 0;
+            size_t i = 0;
+            for (; i + LANES <= count; i += LANES)
+            {
+                result += setBitCount(equalMaskAvx2(data + i, needle));
+            }
+            return result / sizeof(T) + countSse2(data + i, count - i, value);
+        }
+
+        template<typename T>
+        DS_TARGET_AVX2 bool equalAvx2(const T* data1, const T* data2, size_t count)
+        {
+            constexpr size_t LANES = 32 / sizeof(T);
+            size_t i = 0;
+            for (; i + LANES <= count; i += LANES)
+            {
+                const __m256i block1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data1 + i));
+                const __m256i block2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data2 + i));
+                if (static_cast<unsigned int>(_mm256_movemask_epi8(equalLanesAvx2<T>(block1, block2))) != 0xFFFFFFFFu)
+                {
+                    return false;
+                }
+            }
+            return equalSse2(data1 + i, data2 + i, count - i);
+        }
+
+        template<typename T>
+        inline constexpr bool has_avx2_extreme_v =
+            std::is_same_v<T, float> || std::is_same_v<T, double> ||
+            (std::is_integral_v<T> && sizeof(T) <= 4 && !std::is_same_v<T, bool>);
+
+        template<bool IsMax, typename T>
+        DS_TARGET_AVX2 __m256i extremeLanesAvx2(__m256i a, __m256i b)
+        {
+            if constexpr (std::is_same_v<T, float>)
+            {
+                const __m256 fa = _mm256_castsi256_ps(a);
+                const __m256 fb = _mm256_castsi256_ps(b);
+                return _mm256_castps_si256(IsMax ? _mm256_max_ps(fa, fb) : _mm256_min_ps(fa, fb));
+            }
+            else if constexpr (std::is_same_v<T, double>)
+            {
+                const __m256d da = _mm256_castsi256_pd(a);
+                const __m256d db = _mm256_castsi256_pd(b);
+                return _mm256_castpd_si256(IsMax ? _mm256_max_pd(da, db) : _mm256_min_pd(da, db));
+            }
+            else if constexpr (std::is_signed_v<T>)
+            {
+                if constexpr (sizeof(T) == 1) { return IsMax ? _mm256_max_epi8(a, b) : _mm256_min_epi8(a, b); }
+                else if constexpr (sizeof(T) == 2) { return IsMax ? _mm256_max_epi16(a, b) : _mm256_min_epi16(a, b); }
+                else { return IsMax ? _mm256_max_epi32(a, b) : _mm256_min_epi32(a, b); }
+            }
+            else
+            {
+                if constexpr (sizeof(T) == 1) { return IsMax ? _mm256_max_epu8(a, b) : _mm256_min_epu8(a, b); }
+                else if constexpr (sizeof(T) == 2) { return IsMax ? _mm256_max_epu16(a, b) : _mm256_min_epu16(a, b); }
+                else { return IsMax ? _mm256_max_epu32(a, b) : _mm256_min_epu32(a, b); }
+            }
+        }
+
+        template<bool IsMax, typename T>
+        DS_TARGET_AVX2 size_t findExtremeAvx2(const T* data, size_t count)
+        {
+            constexpr size_t LANES = 32 / sizeof(T);
+            if (count < LANES)
+            {
+                return findExtremeScalar<IsMax>(data, count);
+            }
+
+            __m256i extremes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+            size_t i = LANES;
+            for (; i + LANES <= count; i += LANES)
+            {
+                extremes = extremeLanesAvx2<IsMax, T>(extremes, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+            }
+
+            T lanes[LANES];
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), extremes);
+            T extreme = lanes[findExtremeScalar<IsMax>(lanes, LANES)];
+            for (; i < count; ++i)
+            {
+                if (IsMax ? extreme < data[i] : data[i] < extreme)
+                {
+                    extreme = data[i];
+                }
+            }
+            return findAvx2(data, count, extreme);
+        }
+
+        /**
+         * @brief Gathers eight 4-byte or four 8-byte elements per step.
+         * Requires @p stride * 8 to fit into int.
+         */
+        template<typename T>
+        DS_TARGET_AVX2 size_t findStridedAvx2(const T* first, size_t stride, size_t count, const T& value)
+        {
+            constexpr size_t LANES = 32 / sizeof(T);
+            const int step = static_cast<int>(stride);
+            const __m256i needle = broadcastAvx2(value);
+            const unsigned char* base = reinterpret_cast<const unsigned char*>(first);
+            size_t i = 0;
+            for (; i + LANES <= count; i += LANES, base += LANES * stride)
+            {
+                __m256i block;
+                if constexpr (sizeof(T) == 4)
+                {
+                    const __m256i offsets = _mm256_setr_epi32(0, step, 2 * step, 3 * step, 4 * step, 5 * step, 6 * step, 7 * step);
+                    block = _mm256_i32gather_epi32(reinterpret_cast<const int*>(base), offsets, 1);
+                }
+                else
+                {
+                    const __m128i offsets = _mm_setr_epi32(0, step, 2 * step, 3 * step);
+                    block = _mm256_i32gather_epi64(reinterpret_cast<const long long*>(base), offsets, 1);
+                }
+                const unsigned int mask = static_cast<unsigned int>(_mm256_movemask_epi8(equalLanesAvx2<T>(block, needle)));
+                if (mask != 0)
+                {
+                    return i + firstSetBit(mask) / sizeof(T);
+                }
+            }
+            const size_t rest = findStridedScalar(&elementAt(first, stride, i), stride, count - i, value);
+            return rest == INVALID_INDEX ? INVALID_INDEX : i + rest;
+        }
+
+#endif
+    }
+
+    //----------
+
+    inline InstructionSet detectInstructionSet()
+    {
+#ifdef DS_SIMD_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] >= 7)
+        {
+            __cpuid(info, 1);
+            const bool osSavesAvx = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 0x6) == 0x6;
+            __cpuidex(info, 7, 0);
+            if (osSavesAvx && (info[1] & (1 << 5)) != 0)
+            {
+                return InstructionSet::AVX2;
+            }
+        }
+        return InstructionSet::SSE2;
+#else
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") ? InstructionSet::AVX2 : InstructionSet::SSE2;
+#endif
+#else
+        return InstructionSet::Scalar;
+#endif
+    }
+
+    inline InstructionSet getInstructionSet()
+    {
+        return details::activeInstructionSet();
+    }
+
+    inline void setInstructionSet(InstructionSet instructionSet)
+    {
+        const InstructionSet detected = detectInstructionSet();
+        details::activeInstructionSet() = instructionSet < detected ? instructionSet : detected;
+    }
+
+    template<typename T>
+    size_t find(const T* data, size_t count, const T& value)
+    {
+#ifdef DS_SIMD_X86
+        if constexpr (is_vectorizable_v<T>)
+        {
+            switch (getInstructionSet())
+            {
+            case InstructionSet::AVX2:
+                return details::findAvx2(data, count, value);
+            case InstructionSet::SSE2:
+                return details::findSse2(data, count, value);
+            default:
+                break;
+            }
+        }
+#endif
+        return details::findScalar(data, count, value);
+    }
+
+    template<typename T>
+    size_t count(const T* data, size_t count, const T& value)
+    {
+#ifdef DS_SIMD_X86
+        if constexpr (is_vectorizable_v<T>)
+        {
+            switch (getInstructionSet())
+            {
+            case InstructionSet::AVX2:
+                return details::countAvx2(data, count, value);
+            case InstructionSet::SSE2:
+                return details::countSse2(data, count, value);
+            default:
+                break;
+            }
+        }
+#endif
+        return details::countScalar(data, count, value);
+    }
+
+    template<typename T>
+    size_t findMin(const T* data, size_t count)
+    {
+#ifdef DS_SIMD_X86
+        if constexpr (details::has_avx2_extreme_v<T>)
+        {
+            if (getInstructionSet() == InstructionSet::AVX2)
+            {
+                return details::findExtremeAvx2<false>(data, count);
+            }
+        }
+        if constexpr (details::has_sse2_extreme_v<T>)
+        {
+            if (getInstructionSet() != InstructionSet::Scalar)
+            {
+                return details::findExtremeSse2<false>(data, count);
+            }
+        }
+#endif
+        return details::findExtremeScalar<false>(data, count);
+    }
+
+    template<typename T>
+    size_t findMax(const T* data, size_t count)
+    {
+#ifdef DS_SIMD_X86
+        if constexpr (details::has_avx2_extreme_v<T>)
+        {
+            if (getInstructionSet() == InstructionSet::AVX2)
+            {
+                return details::findExtremeAvx2<true>(data, count);
+            }
+        }
+        if constexpr (details::has_sse2_extreme_v<T>)
+        {
+            if (getInstructionSet() != InstructionSet::Scalar)
+            {
+                return details::findExtremeSse2<true>(data, count);
+            }
+        }
+#endif
+        return details::findExtremeScalar<true>(data, count);
+    }
+
+    template<typename T>
+    bool equal(const T* data1, const T* data2, size_t count)
+    {
+#ifdef DS_SIMD_X86
+        if constexpr (is_vectorizable_v<T>)
+        {
+            switch (getInstructionSet())
+            {
+            case InstructionSet::AVX2:
+                return details::equalAvx2(data1, data2, count);
+            case InstructionSet::SSE2:
+                return details::equalSse2(data1, data2, count);
+            default:
+                break;
+            }
+        }
+#endif
+        return details::equalScalar(data1, data2, count);
+    }
+
+    template<typename T>
+    size_t findStrided(const T* first, size_t stride, size_t count, const T& value)
+    {
+#ifdef DS_SIMD_X86
+        if constexpr (is_vectorizable_v<T> && sizeof(T) >= 4)
+        {
+            if (getInstructionSet() == InstructionSet::AVX2 && stride % sizeof(T) == 0 && stride <= 0xFFFFFF)
+            {
+                return details::findStridedAvx2(first, stride, count, value);
+            }
+        }
+#endif
+        return details::findStridedScalar(first, stride, count, value);
+    }
+
+    inline unsigned int matchBytes(const std::uint8_t* group, std::uint8_t value)
+    {
+#ifdef DS_SIMD_X86
+        if (getInstructionSet() != InstructionSet::Scalar)
+        {
+            return details::matchBytesSse2(group, value);
+        }
+#endif
+        return details::matchBytesScalar(group, value);
+    }
+
+    inline unsigned int matchHighBits(const std::uint8_t* group)
+    {
+#ifdef DS_SIMD_X86
+        if (getInstructionSet() != InstructionSet::Scalar)
+        {
+            return details::matchHighBitsSse2(group);
+        }
+#endif
+        return details::matchHighBitsScalar(group);
+    }
+
+    inline void prefetch(const void* address)
+    {
+#ifdef DS_SIMD_X86
+        _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(address);
+#else
+        (void)address;
+#endif
+    }
+}
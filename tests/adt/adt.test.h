@@ -9,6 +9,7 @@
 #include <tests/adt/table.test.h>
 #include <tests/adt/tree.test.h>
 #include <tests/adt/sorts.test.h>
+#include <tests/adt/network_algorithms.test.h>
 
 namespace ds::tests
 {
@@ -26,6 +27,7 @@ namespace ds::tests
             this->add_test(std::make_unique<TableTest>());
             this->add_test(std::make_unique<TreeTest>());
             this->add_test(std::make_unique<SortTest>());
+            this->add_test(std::make_unique<NetworkAlgorithmsTest>());
         }
     };
 }
\ No newline at end of file
@@ -67,6 +67,45 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests copies of a copy-on-write array.
+     */
+    class ArrayTestCopyOnWrite : public LeafTest
+    {
+    public:
+        ArrayTestCopyOnWrite() :
+            LeafTest("copy-on-write")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const size_t size = 10;
+            adt::Array<int> arr1(size);
+            arr1.setCopyOnWrite(true);
+            for (int i = 0; i < static_cast<int>(size); ++i)
+            {
+                arr1.set(i, i);
+            }
+
+            adt::Array<int> arr2(arr1);
+            this->assert_true(arr1.equals(arr2), "Copy constructed array is the same.");
+            this->assert_equals(4, arr2.access(4));
+
+            arr2.set(-1, 4);
+            this->assert_equals(4, arr1.access(4));
+            this->assert_equals(-1, arr2.access(4));
+            this->assert_false(arr1.equals(arr2), "Modified copy is different.");
+
+            adt::Array<int> arr3(size);
+            arr3.assign(arr1);
+            arr1.set(-2, 0);
+            this->assert_equals(0, arr3.access(0));
+            this->assert_equals(-2, arr1.access(0));
+        }
+    };
+
     /**
      * @brief Tests copy constructor, assign, and equals.
      */
@@ -261,6 +300,7 @@ namespace ds::tests
             this->add_test(std::make_unique<ArrayTestGetters>());
             this->add_test(std::make_unique<ArrayTestSetAccess>());
             this->add_test(std::make_unique<ArrayTestCopyAssignEquals>());
+            this->add_test(std::make_unique<ArrayTestCopyOnWrite>());
             this->add_test(std::make_unique<MatrixTestGetters>());
             this->add_test(std::make_unique<MatrixTestSetAccess>());
             this->add_test(std::make_unique<MatrixTestCopyAssignEquals>());
@@ -0,0 +1,223 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/adt/network_algorithms.h>
+#include <libds/amt/explicit_network.h>
+#include <libds/amt/frozen_network.h>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace ds::tests
+{
+    namespace details
+    {
+        /**
+         *  @brief Builds the network used by network algorithm tests.
+         *
+         *  0 - 1 - 2 - 6    7 - 8    9
+         *  |       |
+         *  3 - 4 - 5
+         */
+        template<class Network>
+        std::vector<typename Network::NodeType*> makeAlgorithmNetwork(Network& network)
+        {
+            std::vector<typename Network::NodeType*> nodes;
+            for (int i = 0; i < 10; ++i)
+            {
+                nodes.push_back(&network.insert());
+                nodes.back()->data_ = i;
+            }
+            network.connect(*nodes[0], *nodes[1]);
+            network.connect(*nodes[1], *nodes[2]);
+            network.connect(*nodes[0], *nodes[3]);
+            network.connect(*nodes[3], *nodes[4]);
+            network.connect(*nodes[4], *nodes[5]);
+            network.connect(*nodes[5], *nodes[2]);
+            network.connect(*nodes[2], *nodes[6]);
+            network.connect(*nodes[7], *nodes[8]);
+            return nodes;
+        }
+    }
+
+    /**
+     *  @brief Tests breadth-first and depth-first search.
+     *  @tparam Network Tested network type.
+     */
+    template<class Network>
+    class NetworkAlgorithmsTestSearch : public LeafTest
+    {
+    public:
+        explicit NetworkAlgorithmsTestSearch(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            Network network;
+            auto nodes = details::makeAlgorithmNetwork(network);
+
+            const size_t X = INVALID_INDEX;
+            auto levels = adt::breadthFirstSearch(network, *nodes[0]);
+            this->assert_true(levels == std::vector<size_t>({0, 1, 2, 1, 2, 3, 3, X, X, X}), "BFS levels are correct.");
+
+            levels = adt::breadthFirstSearch(network, *nodes[8]);
+            this->assert_true(levels == std::vector<size_t>({X, X, X, X, X, X, X, 1, 0, X}), "BFS stays in the component.");
+
+            auto order = adt::depthFirstSearch(network, *nodes[0]);
+            this->assert_true(order == std::vector<size_t>({0, 1, 2, 5, 4, 3, 6}), "DFS follows relations in order.");
+
+            auto frozen = amt::freeze(network);
+            this->assert_true(adt::depthFirstSearch(frozen, 9) == std::vector<size_t>({9}), "DFS of isolated node visits only it.");
+            this->assert_throws([&]() { adt::breadthFirstSearch(frozen, 10); }, "Start must be in the network.");
+
+            Network other;
+            auto& foreign = other.insert();
+            this->assert_throws([&]() { adt::breadthFirstSearch(network, foreign); }, "Start node must belong to the network.");
+        }
+    };
+
+    /**
+     *  @brief Tests connected components.
+     *  @tparam Network Tested network type.
+     */
+    template<class Network>
+    class NetworkAlgorithmsTestComponents : public LeafTest
+    {
+    public:
+        explicit NetworkAlgorithmsTestComponents(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            Network network;
+            auto nodes = details::makeAlgorithmNetwork(network);
+
+            auto components = adt::connectedComponents(network);
+            this->assert_true(components == std::vector<size_t>({0, 0, 0, 0, 0, 0, 0, 1, 1, 2}), "Components are numbered by their first node.");
+
+            network.connect(*nodes[9], *nodes[6]);
+            components = adt::connectedComponents(network);
+            this->assert_true(components == std::vector<size_t>({0, 0, 0, 0, 0, 0, 0, 1, 1, 0}), "Connected node joins the component.");
+
+            this->assert_true(adt::connectedComponents(Network()).empty(), "Empty network has no components.");
+        }
+    };
+
+    /**
+     *  @brief Tests Dijkstra's shortest paths.
+     *  @tparam Network Tested network type.
+     */
+    template<class Network>
+    class NetworkAlgorithmsTestDijkstra : public LeafTest
+    {
+    public:
+        explicit NetworkAlgorithmsTestDijkstra(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using NodeType = typename Network::NodeType;
+
+            Network network;
+            auto nodes = details::makeAlgorithmNetwork(network);
+
+            // weight of a relation is the absolute difference of node data
+            const int X = (std::numeric_limits<int>::max)();
+            auto distances = adt::dijkstra<int>(network, *nodes[0], [](const NodeType& a, const NodeType& b)
+                {
+                    return std::abs(a.data_ - b.data_);
+                });
+            this->assert_true(distances == std::vector<int>({0, 1, 2, 3, 4, 5, 6, X, X, X}), "Shortest paths are correct.");
+
+            distances = adt::dijkstra<int>(network, *nodes[5], [](const NodeType& a, const NodeType& b)
+                {
+                    return a.data_ == 2 || b.data_ == 2 ? 10 : 1;
+                });
+            this->assert_true(distances == std::vector<int>({3, 4, 10, 2, 1, 0, 20, X, X, X}), "Longer path with lower weight is preferred.");
+
+            this->assert_throws([&]()
+                {
+                    adt::dijkstra<int>(network, *nodes[0], [](const NodeType&, const NodeType&) { return -1; });
+                }, "Negative weights are rejected.");
+        }
+    };
+
+    /**
+     *  @brief Tests that the parallel BFS gives the same levels as the sequential one.
+     */
+    class NetworkAlgorithmsTestParallelBFS : public LeafTest
+    {
+    public:
+        NetworkAlgorithmsTestParallelBFS() :
+            LeafTest("parallel-bfs")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            amt::IGIRNetwork<int> network;
+            auto nodes = details::makeAlgorithmNetwork(network);
+            auto frozen = amt::freeze(network);
+            for (size_t threads = 1; threads <= 4; threads *= 2)
+            {
+                this->assert_true(
+                    adt::parallelBreadthFirstSearch(frozen, 0, threads) == adt::breadthFirstSearch(frozen, 0),
+                    "Small network has the same levels."
+                );
+            }
+
+            // random network large enough to be split among threads and to switch to bottom-up steps
+            std::default_random_engine rng(144);
+            for (size_t i = nodes.size(); i < 50'000; ++i)
+            {
+                nodes.push_back(&network.insert());
+                std::uniform_int_distribution<size_t> nodeDist(0, nodes.size() - 2);
+                const size_t relations = i % 10 == 0 ? 0 : 1 + i % 3;
+                for (size_t r = 0; r < relations; ++r)
+                {
+                    network.connect(*nodes.back(), *nodes[nodeDist(rng)]);
+                }
+            }
+            auto largeFrozen = amt::freeze(network);
+            const auto expected = adt::breadthFirstSearch(largeFrozen, 20);
+            for (size_t threads = 1; threads <= 4; threads *= 2)
+            {
+                this->assert_true(
+                    adt::parallelBreadthFirstSearch(largeFrozen, 20, threads) == expected,
+                    "Large network has the same levels."
+                );
+            }
+        }
+    };
+
+    /**
+     *  @brief All network algorithm tests.
+     */
+    class NetworkAlgorithmsTest : public CompositeTest
+    {
+    public:
+        NetworkAlgorithmsTest() :
+            CompositeTest("NetworkAlgorithms")
+        {
+            this->add_test(std::make_unique<NetworkAlgorithmsTestSearch<amt::IGIRNetwork<int>>>("search-igir"));
+            this->add_test(std::make_unique<NetworkAlgorithmsTestSearch<amt::EGERNetwork<int>>>("search-eger"));
+            this->add_test(std::make_unique<NetworkAlgorithmsTestComponents<amt::IGERNetwork<int>>>("components-iger"));
+            this->add_test(std::make_unique<NetworkAlgorithmsTestComponents<amt::EGHRNetwork<int>>>("components-eghr"));
+            this->add_test(std::make_unique<NetworkAlgorithmsTestDijkstra<amt::EGIRNetwork<int>>>("dijkstra-egir"));
+            this->add_test(std::make_unique<NetworkAlgorithmsTestDijkstra<amt::IGHRNetwork<int>>>("dijkstra-ighr"));
+            this->add_test(std::make_unique<NetworkAlgorithmsTestParallelBFS>());
+        }
+    };
+}
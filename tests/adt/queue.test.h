@@ -2,7 +2,14 @@
 
 #include <tests/_details/test.hpp>
 #include <libds/adt/queue.h>
+#include <libds/adt/concurrent_queue.h>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <sstream>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 namespace ds::tests
 {
@@ -185,6 +192,425 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests that a full implicit queue grows and keeps the order of wrapped elements.
+     */
+    class ImplicitQueueTestGrow : public LeafTest
+    {
+    public:
+        ImplicitQueueTestGrow() :
+            LeafTest("grow")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            adt::ImplicitQueue<int> queue(4);
+            int pushed = 0;
+            int popped = 0;
+            for (; pushed < 3; ++pushed)
+            {
+                queue.push(pushed);
+            }
+            for (; popped < 2; ++popped)
+            {
+                queue.pop();
+            }
+
+            // The ring wraps before it becomes full and grows.
+            for (; pushed < 100; ++pushed)
+            {
+                queue.push(pushed);
+            }
+            this->assert_true(queue.getCapacity() >= 98, "Full queue grows.");
+            this->assert_equals(static_cast<size_t>(98), queue.size());
+
+            bool ordered = true;
+            for (; popped < 100; ++popped)
+            {
+                ordered = ordered && queue.pop() == popped;
+            }
+            this->assert_true(ordered, "Elements are popped in the order of pushes.");
+            this->assert_true(queue.isEmpty(), "Queue is empty.");
+
+            adt::ImplicitQueue<int> reserved(2);
+            reserved.push(1);
+            reserved.pop();
+            reserved.push(2);
+            reserved.push(3);
+            reserved.reserve(3);
+            this->assert_equals(static_cast<size_t>(3), reserved.getCapacity());
+            reserved.push(4);
+            this->assert_equals(static_cast<size_t>(3), reserved.getCapacity());
+            for (int i = 2; i <= 4; ++i)
+            {
+                this->assert_equals(i, reserved.pop());
+            }
+        }
+    };
+
+    /**
+     * @brief Tests pushRange and popInto of the implicit queue.
+     */
+    class ImplicitQueueTestBulk : public LeafTest
+    {
+    public:
+        ImplicitQueueTestBulk() :
+            LeafTest("bulk")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 250;
+
+            adt::ImplicitQueue<int> queue(8);
+            queue.push(-2);
+            queue.push(-1);
+            this->assert_equals(-2, queue.pop());
+
+            std::vector<int> input(n);
+            for (int i = 0; i < n; ++i)
+            {
+                input[i] = i;
+            }
+            queue.pushRange(input.begin(), input.end());
+            this->assert_equals(static_cast<size_t>(n + 1), queue.size());
+
+            std::istringstream stream("250 251 252");
+            queue.pushRange(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+            this->assert_equals(static_cast<size_t>(n + 4), queue.size());
+
+            std::vector<int> output(n + 10);
+            this->assert_equals(static_cast<size_t>(1), queue.popInto(output.data(), 1));
+            this->assert_equals(-1, output[0]);
+            this->assert_equals(static_cast<size_t>(n + 3), queue.popInto(output.data(), output.size()));
+            bool ordered = true;
+            for (int i = 0; i < n + 3; ++i)
+            {
+                ordered = ordered && output[i] == i;
+            }
+            this->assert_true(ordered, "Elements are popped in the order of pushes.");
+            this->assert_equals(static_cast<size_t>(0), queue.popInto(output.data(), output.size()));
+            this->assert_true(queue.isEmpty(), "Queue is empty.");
+        }
+    };
+
+    /**
+     * @brief Tests that elements pushed by several producers are popped by several consumers
+     * exactly once and in the order of each producer.
+     * @tparam QueueT Type of the concurrent queue.
+     */
+    template<class QueueT>
+    class QueueTestConcurrent : public LeafTest
+    {
+    public:
+        QueueTestConcurrent() :
+            LeafTest("concurrent")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int producerCount = 4;
+            constexpr int consumerCount = 4;
+            constexpr int n = 20'000;
+
+            QueueT queue = this->makeQueue();
+            std::vector<std::atomic<int>> popCounts(producerCount * n);
+            std::atomic<int> popped = 0;
+            std::atomic<bool> ordered = true;
+
+            std::vector<std::thread> threads;
+            for (int p = 0; p < producerCount; ++p)
+            {
+                threads.emplace_back([&queue, p]()
+                    {
+                        for (int i = 0; i < n; ++i)
+                        {
+                            if constexpr (std::is_same_v<QueueT, adt::BoundedConcurrentQueue<int>>)
+                            {
+                                while (!queue.tryPush(p * n + i))
+                                {
+                                    std::this_thread::yield();
+                                }
+                            }
+                            else
+                            {
+                                queue.push(p * n + i);
+                            }
+                        }
+                    });
+            }
+            for (int c = 0; c < consumerCount; ++c)
+            {
+                threads.emplace_back([&]()
+                    {
+                        std::vector<int> last(producerCount, -1);
+                        int element;
+                        while (popped.load() < producerCount * n)
+                        {
+                            if (queue.tryPop(element))
+                            {
+                                popped.fetch_add(1);
+                                popCounts[element].fetch_add(1);
+                                const int producer = element / n;
+                                if (element % n <= last[producer])
+                                {
+                                    ordered = false;
+                                }
+                                last[producer] = element % n;
+                            }
+                        }
+                    });
+            }
+            for (std::thread& thread : threads)
+            {
+                thread.join();
+            }
+
+            bool exactlyOnce = true;
+            for (const std::atomic<int>& count : popCounts)
+            {
+                exactlyOnce = exactlyOnce && count.load() == 1;
+            }
+            this->assert_true(exactlyOnce, "Every element is popped exactly once.");
+            this->assert_true(ordered.load(), "Elements of a producer are popped in order.");
+            this->assert_true(queue.isEmpty(), "Queue is empty.");
+        }
+
+    private:
+        QueueT makeQueue()
+        {
+            if constexpr (std::is_same_v<QueueT, adt::BoundedConcurrentQueue<int>>)
+            {
+                // Small enough for producers to wait for consumers.
+                return QueueT(64);
+            }
+            else
+            {
+                return QueueT();
+            }
+        }
+    };
+
+    /**
+     * @brief Tests push to a full bounded queue.
+     */
+    class BoundedQueueTestFull : public LeafTest
+    {
+    public:
+        BoundedQueueTestFull() :
+            LeafTest("full")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            adt::BoundedConcurrentQueue<int> queue(3);
+            this->assert_equals(static_cast<size_t>(4), queue.getCapacity());
+            for (int i = 0; i < 4; ++i)
+            {
+                this->assert_true(queue.tryPush(i), "Queue with free cells accepts an element.");
+            }
+            this->assert_false(queue.tryPush(4), "Full queue rejects an element.");
+            this->assert_throws([&queue]()
+                {
+                    queue.push(4);
+                },
+                "Push to a full queue throws."
+            );
+            this->assert_equals(0, queue.pop());
+            queue.push(4);
+            this->assert_throws([&queue]()
+                {
+                    queue.peek();
+                },
+                "Concurrent queue can't be peeked."
+            );
+            for (int i = 1; i <= 4; ++i)
+            {
+                this->assert_equals(i, queue.pop());
+            }
+        }
+    };
+
+    /**
+     * @brief Tests batch push and pop across the end of the ring.
+     */
+    class SpscQueueTestBatch : public LeafTest
+    {
+    public:
+        SpscQueueTestBatch() :
+            LeafTest("batch")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            adt::SpscQueue<int> queue(8);
+            std::vector<int> input = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+            std::vector<int> output(10, -1);
+
+            this->assert_equals(static_cast<size_t>(5), queue.pushN(input.data(), 5));
+            this->assert_equals(static_cast<size_t>(3), queue.popN(output.data(), 3));
+            this->assert_equals(static_cast<size_t>(6), queue.pushN(input.data() + 5, 6));
+            this->assert_equals(static_cast<size_t>(8), queue.size());
+            this->assert_equals(static_cast<size_t>(0), queue.pushN(input.data(), 1));
+            this->assert_false(queue.tryPush(0), "Full queue rejects an element.");
+            this->assert_equals(3, queue.peek());
+
+            this->assert_equals(static_cast<size_t>(7), queue.popN(output.data() + 3, 7));
+            for (int i = 0; i < 10; ++i)
+            {
+                this->assert_equals(i, output[i]);
+            }
+            this->assert_equals(static_cast<size_t>(1), queue.popN(output.data(), 10));
+            this->assert_equals(10, output[0]);
+            this->assert_equals(static_cast<size_t>(0), queue.popN(output.data(), 10));
+            this->assert_true(queue.isEmpty(), "Queue is empty.");
+        }
+    };
+
+    /**
+     * @brief Tests that elements passed from a producer thread to a consumer thread
+     * arrive complete and in order, both one by one and in batches.
+     */
+    class SpscQueueTestHandoff : public LeafTest
+    {
+    public:
+        SpscQueueTestHandoff() :
+            LeafTest("handoff")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 200'000;
+            constexpr size_t batchSize = 37;
+
+            adt::SpscQueue<int> queue(64);
+            bool ordered = true;
+            std::thread producer([&]()
+                {
+                    std::vector<int> batch(batchSize);
+                    int next = 0;
+                    while (next < n)
+                    {
+                        if (next % 2 == 0)
+                        {
+                            const size_t count = std::min<size_t>(batchSize, n - next);
+                            for (size_t i = 0; i < count; ++i)
+                            {
+                                batch[i] = next + static_cast<int>(i);
+                            }
+                            size_t pushed = 0;
+                            while (pushed < count)
+                            {
+                                pushed += queue.pushN(batch.data() + pushed, count - pushed);
+                            }
+                            next += static_cast<int>(count);
+                        }
+                        else
+                        {
+                            while (!queue.tryPush(next))
+                            {
+                                std::this_thread::yield();
+                            }
+                            ++next;
+                        }
+                    }
+                });
+
+            std::vector<int> batch(batchSize);
+            int expected = 0;
+            while (expected < n)
+            {
+                const size_t popped = queue.popN(batch.data(), batchSize);
+                for (size_t i = 0; i < popped; ++i)
+                {
+                    ordered = ordered && batch[i] == expected;
+                    ++expected;
+                }
+                int element;
+                if (queue.tryPop(element))
+                {
+                    ordered = ordered && element == expected;
+                    ++expected;
+                }
+            }
+            producer.join();
+
+            this->assert_true(ordered, "Elements are popped in the order of pushes.");
+            this->assert_true(queue.isEmpty(), "Queue is empty.");
+        }
+    };
+
+    /**
+     * @brief All concurrent queue leaf tests.
+     * @tparam QueueT Type of the concurrent queue.
+     */
+    template<class QueueT>
+    class ConcurrentQueueTest : public CompositeTest
+    {
+    public:
+        ConcurrentQueueTest(const std::string& name) :
+            CompositeTest(name)
+        {
+            this->add_test(std::make_unique<QueueTestPop<QueueT>>());
+            this->add_test(std::make_unique<QueueTestClear<QueueT>>());
+            this->add_test(std::make_unique<QueueTestCopyAssignEquals<QueueT>>());
+            this->add_test(std::make_unique<QueueTestConcurrent<QueueT>>());
+        }
+    };
+
+    /**
+     * @brief ImplicitQueue tests.
+     */
+    class ImplicitQueueTest : public GeneralQueueTest<adt::ImplicitQueue<int>>
+    {
+    public:
+        ImplicitQueueTest() :
+            GeneralQueueTest<adt::ImplicitQueue<int>>("ImplicitQueue")
+        {
+            this->add_test(std::make_unique<ImplicitQueueTestGrow>());
+            this->add_test(std::make_unique<ImplicitQueueTestBulk>());
+        }
+    };
+
+    /**
+     * @brief BoundedConcurrentQueue tests.
+     */
+    class BoundedConcurrentQueueTest : public ConcurrentQueueTest<adt::BoundedConcurrentQueue<int>>
+    {
+    public:
+        BoundedConcurrentQueueTest() :
+            ConcurrentQueueTest<adt::BoundedConcurrentQueue<int>>("BoundedConcurrentQueue")
+        {
+            this->add_test(std::make_unique<BoundedQueueTestFull>());
+        }
+    };
+
+    /**
+     * @brief SpscQueue tests.
+     */
+    class SpscQueueTest : public GeneralQueueTest<adt::SpscQueue<int>>
+    {
+    public:
+        SpscQueueTest() :
+            GeneralQueueTest<adt::SpscQueue<int>>("SpscQueue")
+        {
+            this->add_test(std::make_unique<SpscQueueTestBatch>());
+            this->add_test(std::make_unique<SpscQueueTestHandoff>());
+        }
+    };
+
     /**
      * @brief All queue tests.
      */
@@ -194,8 +620,11 @@ namespace ds::tests
         QueueTest() :
             CompositeTest("Queue")
         {
-            this->add_test(std::make_unique<GeneralQueueTest<adt::ImplicitQueue<int>>>("ImplicitQueue"));
+            this->add_test(std::make_unique<ImplicitQueueTest>());
             this->add_test(std::make_unique<GeneralQueueTest<adt::ExplicitQueue<int>>>("ExplicitQueue"));
+            this->add_test(std::make_unique<ConcurrentQueueTest<adt::ConcurrentQueue<int>>>("ConcurrentQueue"));
+            this->add_test(std::make_unique<BoundedConcurrentQueueTest>());
+            this->add_test(std::make_unique<SpscQueueTest>());
         }
     };
 }
\ No newline at end of file
@@ -2,6 +2,10 @@
 
 #include <tests/_details/test.hpp>
 #include <libds/adt/stack.h>
+#include <libds/adt/work_stealing_deque.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 
 namespace ds::tests
 {
@@ -169,6 +173,144 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests that thieves take the oldest elements while the owner pops the newest,
+     * also after the deque grows.
+     */
+    class WorkStealingDequeTestSteal : public LeafTest
+    {
+    public:
+        WorkStealingDequeTestSteal() :
+            LeafTest("steal")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int n = 10;
+
+            adt::WorkStealingDeque<int> deque(4);
+            int element = -1;
+            this->assert_false(deque.steal(element), "Empty deque can't be stolen from.");
+            this->assert_throws([&deque]()
+                {
+                    deque.peek();
+                },
+                "Work-stealing deque can't be peeked."
+            );
+
+            for (int i = 0; i < n; ++i)
+            {
+                deque.push(i);
+            }
+            this->assert_equals(static_cast<size_t>(16), deque.getCapacity());
+            this->assert_equals(static_cast<size_t>(n), deque.size());
+
+            this->assert_true(deque.steal(element), "Thief steals from a non-empty deque.");
+            this->assert_equals(0, element);
+            this->assert_equals(n - 1, deque.pop());
+            this->assert_true(deque.steal(element), "Thief steals from a non-empty deque.");
+            this->assert_equals(1, element);
+
+            for (int i = n - 2; i >= 2; --i)
+            {
+                this->assert_equals(i, deque.pop());
+            }
+            this->assert_false(deque.tryPop(element), "Empty deque can't be popped.");
+            this->assert_true(deque.isEmpty(), "Deque is empty.");
+        }
+    };
+
+    /**
+     * @brief Tests that every element pushed by the owner is taken exactly once while
+     * several thieves steal and the owner keeps pushing and popping.
+     */
+    class WorkStealingDequeTestStress : public LeafTest
+    {
+    public:
+        WorkStealingDequeTestStress() :
+            LeafTest("stress")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            constexpr int thiefCount = 3;
+            constexpr int n = 100'000;
+
+            adt::WorkStealingDeque<int> deque(8);
+            std::vector<std::atomic<int>> takeCounts(n);
+            std::atomic<int> taken = 0;
+
+            std::vector<std::thread> thieves;
+            for (int t = 0; t < thiefCount; ++t)
+            {
+                thieves.emplace_back([&]()
+                    {
+                        int element;
+                        while (taken.load() < n)
+                        {
+                            if (deque.steal(element))
+                            {
+                                takeCounts[element].fetch_add(1);
+                                taken.fetch_add(1);
+                            }
+                        }
+                    });
+            }
+
+            int element;
+            for (int i = 0; i < n; ++i)
+            {
+                deque.push(i);
+                if (i % 3 == 0 && deque.tryPop(element))
+                {
+                    takeCounts[element].fetch_add(1);
+                    taken.fetch_add(1);
+                }
+            }
+            while (taken.load() < n)
+            {
+                if (deque.tryPop(element))
+                {
+                    takeCounts[element].fetch_add(1);
+                    taken.fetch_add(1);
+                }
+            }
+            for (std::thread& thief : thieves)
+            {
+                thief.join();
+            }
+
+            bool exactlyOnce = true;
+            for (const std::atomic<int>& count : takeCounts)
+            {
+                exactlyOnce = exactlyOnce && count.load() == 1;
+            }
+            this->assert_true(exactlyOnce, "Every element is taken exactly once.");
+            this->assert_true(deque.isEmpty(), "Deque is empty.");
+        }
+    };
+
+    /**
+     * @brief All work-stealing deque tests.
+     */
+    class WorkStealingDequeTest : public CompositeTest
+    {
+    public:
+        WorkStealingDequeTest() :
+            CompositeTest("WorkStealingDeque")
+        {
+            this->add_test(std::make_unique<StackTestPop<adt::WorkStealingDeque<int>>>());
+            this->add_test(std::make_unique<StackTestClear<adt::WorkStealingDeque<int>>>());
+            this->add_test(std::make_unique<StackTestCopyAssignEquals<adt::WorkStealingDeque<int>>>());
+            this->add_test(std::make_unique<WorkStealingDequeTestSteal>());
+            this->add_test(std::make_unique<WorkStealingDequeTestStress>());
+        }
+    };
+
     /**
      * @brief All stack tests.
      */
@@ -180,6 +322,7 @@ namespace ds::tests
         {
             this->add_test(std::make_unique<GeneralStackTest<adt::ImplicitStack<int>>>("ImplicitStack"));
             this->add_test(std::make_unique<GeneralStackTest<adt::ExplicitStack<int>>>("ExplicitStack"));
+            this->add_test(std::make_unique<WorkStealingDequeTest>());
         }
     };
 }
\ No newline at end of file
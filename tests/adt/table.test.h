@@ -1,10 +1,18 @@
 #pragma once
 
 #include <algorithm>
+#include <libds/adt/flat_hash_table.h>
+#include <libds/adt/robin_hood_hash_table.h>
 #include <libds/adt/table.h>
 #include <memory>
 #include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <tests/_details/test.hpp>
 
 namespace ds::tests
@@ -45,6 +53,49 @@ namespace ds::tests
                 return true;
             }
 
+            /**
+             * @brief Inserts or removes @p operations random keys below @p keyRange in both @p table
+             * and @p reference, a key is removed if it is present. Returns whether every remove
+             * returned the data of the reference.
+             */
+            bool churn(TableT& table, std::unordered_map<int, int>& reference, int operations, int keyRange)
+            {
+                auto keyDist = std::uniform_int_distribution<int>(0, keyRange - 1);
+                auto consistent = true;
+                for (auto i = 0; i < operations; ++i)
+                {
+                    auto const key = keyDist(rngKey_);
+                    if (reference.count(key) != 0)
+                    {
+                        consistent = consistent && table.remove(key) == reference[key];
+                        reference.erase(key);
+                    }
+                    else
+                    {
+                        table.insert(key, i);
+                        reference[key] = i;
+                    }
+                }
+                return consistent;
+            }
+
+            /**
+             * @brief Whether exactly the keys of @p reference below @p keyRange are found in @p table,
+             * with the same data.
+             */
+            static bool matchesReference(TableT& table, const std::unordered_map<int, int>& reference, int keyRange)
+            {
+                auto consistent = true;
+                for (auto key = 0; key < keyRange; ++key)
+                {
+                    int* data = nullptr;
+                    auto const found = table.tryFind(key, data);
+                    auto const it = reference.find(key);
+                    consistent = consistent && found == (it != reference.end()) && (!found || *data == it->second);
+                }
+                return consistent;
+            }
+
         protected:
             std::mt19937_64 rngKey_;
         };
@@ -479,6 +530,615 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests lowerBound, upperBound, equalRange and range of an ordered table against a reference set.
+     * @tparam TableT Ordered table type
+     */
+    template<class TableT>
+    class TableTestRange : public details::TableTestBase<TableT>
+    {
+    public:
+        TableTestRange() :
+            details::TableTestBase<TableT>("range", 50)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto constexpr n = 1'000;
+            auto table = TableT();
+            auto reference = std::set<int>();
+            for (auto const key : this->generateKeys(n))
+            {
+                table.insert(3 * key, key);
+                reference.insert(3 * key);
+            }
+
+            auto rangesMatch = true;
+            auto boundsMatch = true;
+            std::uniform_int_distribution<int> keyDist(-5, 3 * n + 5);
+            for (auto i = 0; i < 200; ++i)
+            {
+                auto const from = keyDist(this->rngKey_);
+                auto const to = keyDist(this->rngKey_);
+                rangesMatch = rangesMatch && matches(table.range(from, to),
+                    from < to ? reference.lower_bound(from) : reference.end(),
+                    from < to ? reference.lower_bound(to) : reference.end());
+                rangesMatch = rangesMatch && matches(table.equalRange(from), reference.lower_bound(from), reference.upper_bound(from));
+                boundsMatch = boundsMatch && matches(typename TableT::RangeType(table.lowerBound(from), table.upperBound(3 * n)),
+                    reference.lower_bound(from), reference.end());
+                boundsMatch = boundsMatch && matches(typename TableT::RangeType(table.upperBound(from), table.upperBound(3 * n)),
+                    reference.upper_bound(from), reference.end());
+            }
+            this->assert_true(rangesMatch, "Ranges contain the keys of the reference range.");
+            this->assert_true(boundsMatch, "Bounds point where the reference bounds do.");
+            this->assert_true(matches(table.range(-1, 3 * n), reference.begin(), reference.end()), "Range of all keys has every item.");
+        }
+
+    private:
+        static bool matches(typename TableT::RangeType range, std::set<int>::const_iterator first, std::set<int>::const_iterator last)
+        {
+            for (auto& item : range)
+            {
+                if (first == last || item.key_ != *first || item.data_ != *first / 3)
+                {
+                    return false;
+                }
+                ++first;
+            }
+            return first == last;
+        }
+    };
+
+    /**
+     * @brief Tests that building a sorted table from an unsorted range with duplicate keys gives
+     * the same table as inserting its distinct keys one by one.
+     */
+    class SortedSequenceTableTestBuild : public details::TableTestBase<adt::SortedSequenceTable<int, int>>
+    {
+    public:
+        SortedSequenceTableTestBuild() :
+            details::TableTestBase<adt::SortedSequenceTable<int, int>>("build-from-range", 48)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto constexpr n = 2'000;
+            auto items = std::vector<adt::TableItem<int, int>>();
+            auto inserted = adt::SortedSequenceTable<int, int>();
+            for (auto const key : this->generateKeys(n))
+            {
+                items.push_back({ key, key });
+                inserted.insert(key, key);
+            }
+            for (auto const key : this->generateKeys(n / 2))
+            {
+                items.push_back({ key, -key });
+            }
+
+            auto built = adt::SortedSequenceTable<int, int>();
+            built.insert(-1, -1);
+            built.buildFromRange(items.begin(), items.end());
+            this->assert_equals(static_cast<size_t>(n), built.size());
+            this->assert_true(built.equals(inserted), "Built table equals the table of inserted keys.");
+
+            auto previous = -1;
+            auto sorted = true;
+            for (auto& item : built)
+            {
+                sorted = sorted && previous < item.key_;
+                previous = item.key_;
+            }
+            this->assert_true(sorted, "Keys are sorted.");
+            this->assert_false(built.contains(-1), "Previous items are replaced.");
+
+            built.buildFromRange(items.end(), items.end());
+            this->assert_true(built.isEmpty(), "Empty range builds an empty table.");
+        }
+    };
+
+    /**
+     * @brief Tests lookups of present and missing keys in Eytzinger ordered snapshots of sorted
+     * tables of every size up to a complete tree and beyond.
+     */
+    class FrozenSortedTableTest : public details::TableTestBase<adt::FrozenSortedTable<int, int>>
+    {
+    public:
+        FrozenSortedTableTest() :
+            details::TableTestBase<adt::FrozenSortedTable<int, int>>("FrozenSortedTable", 49)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto found = true;
+            auto missing = true;
+            for (auto n = 0; n <= 70; ++n)
+            {
+                auto sorted = adt::SortedSequenceTable<int, int>();
+                for (auto const key : this->generateKeys(n))
+                {
+                    sorted.insert(2 * key, key);
+                }
+
+                auto frozen = adt::FrozenSortedTable<int, int>(sorted);
+                found = found && frozen.size() == sorted.size() && frozen.equals(sorted);
+                for (auto key = -1; key <= 2 * n; key += 2)
+                {
+                    missing = missing && !frozen.contains(key);
+                }
+            }
+            this->assert_true(found, "Snapshots contain exactly the items of their tables.");
+            this->assert_true(missing, "Missing keys are not found.");
+
+            auto sorted = adt::SortedSequenceTable<int, int>();
+            sorted.insert(1, 1);
+            auto frozen = adt::FrozenSortedTable<int, int>(sorted);
+            frozen.find(1) = 2;
+            this->assert_equals(2, frozen.find(1));
+            this->assert_throws([&]()
+                {
+                    frozen.insert(3, 3);
+                }, "Insert is unavailable.");
+            auto copy = adt::FrozenSortedTable<int, int>(frozen);
+            this->assert_true(copy.equals(frozen), "Copy equals the snapshot.");
+        }
+    };
+
+    /**
+     * @brief Tests that the hash table grows and shrinks with its load factor.
+     */
+    class HashTableTestResize : public details::TableTestBase<adt::HashTable<int, int>>
+    {
+    public:
+        HashTableTestResize() :
+            details::TableTestBase<adt::HashTable<int, int>>("resize", 271)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto constexpr n = 10'000;
+            auto table = adt::HashTable<int, int>();
+            auto const initialBucketCount = table.getBucketCount();
+            auto const keys = this->generateKeys(n);
+            for (auto const key : keys)
+            {
+                table.insert(key, key);
+            }
+
+            this->assert_true(table.getBucketCount() > initialBucketCount, "Bucket count grows.");
+            this->assert_true(table.getLoadFactor() <= adt::HashTable<int, int>::MAX_LOAD_FACTOR, "Load factor stays under its maximum.");
+            this->assert_true(hasKeys(table, keys), "All keys are found after growth.");
+
+            for (auto i = 0; i < n - 10; ++i)
+            {
+                table.remove(keys[i]);
+            }
+            this->assert_equals(initialBucketCount, table.getBucketCount());
+            this->assert_true(hasKeys(table, std::vector<int>(keys.end() - 10, keys.end())), "Remaining keys are found after shrinking.");
+
+            auto reserved = adt::HashTable<int, int>();
+            reserved.reserve(n);
+            auto const reservedBucketCount = reserved.getBucketCount();
+            this->assert_true(reservedBucketCount >= static_cast<size_t>(n), "Reserve makes room for all elements.");
+            for (auto const key : keys)
+            {
+                reserved.insert(key, key);
+            }
+            this->assert_equals(reservedBucketCount, reserved.getBucketCount());
+            for (auto const key : keys)
+            {
+                reserved.remove(key);
+            }
+            this->assert_equals(reservedBucketCount, reserved.getBucketCount());
+            this->assert_true(reserved.isEmpty(), "Table is empty.");
+        }
+    };
+
+    /**
+     * @brief Tests the hash table in incremental rehash mode against a reference map, including
+     * lookups, iteration and copies while buckets wait in the old primary region.
+     */
+    class HashTableTestIncrementalRehash : public details::TableTestBase<adt::HashTable<int, int>>
+    {
+    public:
+        HashTableTestIncrementalRehash() :
+            details::TableTestBase<adt::HashTable<int, int>>("incremental-rehash", 828)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto constexpr n = 20'000;
+            auto table = adt::HashTable<int, int>();
+            table.setIncrementalRehash(true);
+            auto reference = std::unordered_map<int, int>();
+            auto const keys = this->generateKeys(n);
+            auto consistent = true;
+            auto wasRehashing = false;
+            for (auto i = 0; i < n; ++i)
+            {
+                table.insert(keys[i], i);
+                reference[keys[i]] = i;
+                if (table.isRehashing())
+                {
+                    wasRehashing = true;
+                    consistent = consistent && (i % 16 != 0 || matches(table, reference));
+                }
+            }
+            this->assert_true(wasRehashing, "Growth migrates buckets incrementally.");
+            this->assert_true(consistent, "Table matches the reference map while growing.");
+            this->assert_true(findsAll(table, reference), "All keys are found after growth.");
+
+            wasRehashing = false;
+            consistent = true;
+            for (auto i = 0; i < n - 100; ++i)
+            {
+                consistent = consistent && table.remove(keys[i]) == reference[keys[i]];
+                reference.erase(keys[i]);
+                if (table.isRehashing() && i % 16 == 0)
+                {
+                    wasRehashing = true;
+                    auto copy = adt::HashTable<int, int>(table);
+                    consistent = consistent && copy.equals(table) && matches(table, reference) && matches(copy, reference);
+                }
+            }
+            this->assert_true(wasRehashing, "Shrinking migrates buckets incrementally.");
+            this->assert_true(consistent, "Table and its copies match the reference map while shrinking.");
+
+            for (auto i = 0; !table.isRehashing() && i < n - 100; ++i)
+            {
+                table.insert(keys[i], i);
+                reference[keys[i]] = i;
+            }
+            this->assert_true(table.isRehashing(), "Growth starts another migration.");
+            int* kept = nullptr;
+            this->assert_true(table.tryFind(keys.back(), kept), "Kept key is found.");
+            int* keptAddress = nullptr;
+            for (auto& item : table)
+            {
+                keptAddress = item.key_ == keys.back() ? &item.data_ : keptAddress;
+            }
+            consistent = true;
+            for (auto i = 0; i < 4; ++i)
+            {
+                consistent = consistent && findsAll(table, reference);
+            }
+            this->assert_true(consistent, "All keys are found during the migration.");
+            this->assert_true(table.isRehashing(), "Lookups don't migrate buckets.");
+            this->assert_true(kept == keptAddress && *kept == reference[keys.back()],
+                "Data found earlier stays valid across later lookups.");
+
+            table.setIncrementalRehash(false);
+            this->assert_false(table.isIncrementalRehash(), "Incremental mode is off.");
+            this->assert_false(table.isRehashing(), "Turning the mode off finishes the migration.");
+            this->assert_true(matches(table, reference), "Table matches the reference map after the migration.");
+        }
+
+    private:
+        /**
+         * @brief Whether iterating @p table yields exactly the items of @p reference.
+         */
+        static bool matches(const adt::HashTable<int, int>& table, const std::unordered_map<int, int>& reference)
+        {
+            auto count = size_t{ 0 };
+            for (auto& item : table)
+            {
+                auto const it = reference.find(item.key_);
+                if (it == reference.end() || it->second != item.data_)
+                {
+                    return false;
+                }
+                ++count;
+            }
+            return count == reference.size() && table.size() == reference.size();
+        }
+
+        static bool findsAll(const adt::HashTable<int, int>& table, const std::unordered_map<int, int>& reference)
+        {
+            for (auto const& [key, data] : reference)
+            {
+                int* found = nullptr;
+                if (!table.tryFind(key, found) || *found != data)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    };
+
+    /**
+     * @brief Tests a hash table with string keys, looked up by std::string, string_view and C string,
+     * also with a hash function putting every key into one bucket so that stored hashes all match.
+     */
+    class HashTableTestStringKeys : public details::TableTestBase<adt::HashTable<std::string, int>>
+    {
+    public:
+        HashTableTestStringKeys() :
+            details::TableTestBase<adt::HashTable<std::string, int>>("string-keys", 46)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto constexpr n = 1'000;
+            auto const keys = this->generateKeys(n);
+            auto table = adt::HashTable<std::string, int>();
+            auto collided = adt::HashTable<std::string, int>([](std::string_view) { return size_t{ 0 }; }, 16);
+            for (auto const key : keys)
+            {
+                table.insert("key-" + std::to_string(key), key);
+                collided.insert("key-" + std::to_string(key), key);
+            }
+
+            auto found = true;
+            for (auto const key : keys)
+            {
+                auto const name = "key-" + std::to_string(key);
+                auto const view = std::string_view(name);
+                int* data = nullptr;
+                found = found && table.tryFind(view, data) && *data == key;
+                found = found && table.find(name.c_str()) == key && table.contains(name);
+                found = found && collided.tryFind(view, data) && *data == key;
+            }
+            this->assert_true(found, "Keys are found by std::string, string_view and C string.");
+            this->assert_false(table.contains("key-"), "Missing key is not found.");
+            this->assert_false(collided.contains(std::string_view("key-1000")), "Missing synonym is not found.");
+
+            for (auto i = 0; i < n / 2; ++i)
+            {
+                collided.remove("key-" + std::to_string(keys[i]));
+            }
+            this->assert_equals(static_cast<size_t>(n / 2), collided.size());
+            this->assert_false(collided.contains("key-" + std::to_string(keys[0])), "Removed synonym is not found.");
+            this->assert_true(collided.contains("key-" + std::to_string(keys[n - 1])), "Remaining synonym is found.");
+        }
+    };
+
+    /**
+     * @brief Tests that a batched lookup of present and missing keys gives the same results as tryFind.
+     * @tparam TableT Hash table type
+     */
+    template<class TableT>
+    class HashTableTestFindBatch : public details::TableTestBase<TableT>
+    {
+    public:
+        HashTableTestFindBatch() :
+            details::TableTestBase<TableT>("find-batch", 47)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto constexpr n = 5'000;
+            auto table = TableT();
+            for (auto const key : this->generateKeys(n))
+            {
+                table.insert(2 * key, key);
+            }
+
+            auto const keys = this->generateKeys(2 * n + 3);
+            auto data = std::vector<int*>(keys.size());
+            auto const found = table.tryFindBatch(keys.data(), keys.size(), data.data());
+            this->assert_equals(static_cast<size_t>(n), found);
+
+            auto consistent = true;
+            for (auto i = size_t{ 0 }; i < keys.size(); ++i)
+            {
+                int* expected = nullptr;
+                consistent = consistent && (table.tryFind(keys[i], expected) ? data[i] == expected : data[i] == nullptr);
+            }
+            this->assert_true(consistent, "Batched lookup matches tryFind.");
+            this->assert_equals(size_t{ 0 }, table.tryFindBatch(keys.data(), 0, data.data()));
+
+            if constexpr (std::is_same_v<TableT, adt::HashTable<int, int>>)
+            {
+                this->testDuringRehash();
+            }
+        }
+
+    private:
+        /**
+         * @brief Runs a batch longer than BATCH_SIZE while an incremental rehash is in progress.
+         * Data found for the first keys has to stay valid while the later ones are looked up.
+         */
+        void testDuringRehash()
+        {
+            auto table = TableT();
+            table.setIncrementalRehash(true);
+            auto keys = std::vector<int>();
+            for (auto const key : this->generateKeys(1'000))
+            {
+                if (table.isRehashing())
+                {
+                    break;
+                }
+                table.insert(key, key);
+                keys.push_back(key);
+            }
+            this->assert_true(table.isRehashing(), "Table is rehashing.");
+
+            auto data = std::vector<int*>(keys.size());
+            this->assert_equals(keys.size(), table.tryFindBatch(keys.data(), keys.size(), data.data()));
+            this->assert_true(table.isRehashing(), "Batched lookup doesn't migrate buckets.");
+
+            auto addresses = std::unordered_map<int, int*>();
+            for (auto& item : table)
+            {
+                addresses[item.key_] = &item.data_;
+            }
+            auto valid = true;
+            for (auto i = size_t{ 0 }; i < keys.size(); ++i)
+            {
+                valid = valid && data[i] == addresses[keys[i]] && *data[i] == keys[i];
+            }
+            this->assert_true(valid, "Data of the whole batch stays valid during the rehash.");
+        }
+    };
+
+    /**
+     * @brief Tests the open addressing hash table against a reference map under random inserts
+     * and removes, which leave tombstones, with every instruction set used to probe the groups.
+     */
+    class FlatHashTableTestChurn : public details::TableTestBase<adt::FlatHashTable<int, int>>
+    {
+    public:
+        FlatHashTableTestChurn() :
+            details::TableTestBase<adt::FlatHashTable<int, int>>("churn", 314)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const simd::InstructionSet detected = simd::getInstructionSet();
+            for (simd::InstructionSet instructionSet : { simd::InstructionSet::Scalar, detected })
+            {
+                simd::setInstructionSet(instructionSet);
+                this->testChurn();
+            }
+            simd::setInstructionSet(detected);
+        }
+
+    private:
+        void testChurn()
+        {
+            auto constexpr n = 50'000;
+            auto constexpr keyRange = 2'000;
+            auto table = adt::FlatHashTable<int, int>();
+            auto reference = std::unordered_map<int, int>();
+            auto const consistent = this->churn(table, reference, n, keyRange);
+            this->assert_true(consistent && this->matchesReference(table, reference, keyRange), "Table matches the reference map.");
+            this->assert_equals(reference.size(), table.size());
+            this->assert_true(table.getCapacity() <= 4 * keyRange, "Tombstones don't make the table grow without bound.");
+            this->assert_true(table.getLoadFactor() <= 0.875, "Load factor stays under 7/8.");
+        }
+    };
+
+    /**
+     * @brief Tests the Robin Hood hash table against a reference map under random inserts and
+     * removes, and checks that backward shift deletion keeps probe lengths short.
+     */
+    class RobinHoodHashTableTestProbeLength : public details::TableTestBase<adt::RobinHoodHashTable<int, int>>
+    {
+    public:
+        RobinHoodHashTableTestProbeLength() :
+            details::TableTestBase<adt::RobinHoodHashTable<int, int>>("probe-length", 577)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto constexpr n = 50'000;
+            auto constexpr keyRange = 4'000;
+            auto table = adt::RobinHoodHashTable<int, int>();
+            this->assert_equals(size_t{ 0 }, table.getProbeLengthStatistics().max_);
+
+            auto reference = std::unordered_map<int, int>();
+            auto const consistent = this->churn(table, reference, n, keyRange);
+            this->assert_true(consistent && this->matchesReference(table, reference, keyRange), "Table matches the reference map.");
+            this->assert_equals(reference.size(), table.size());
+            this->assert_true(table.getLoadFactor() <= 0.875, "Load factor stays under 7/8.");
+
+            // Backward shift deletion leaves no trace of removed items, so the churned table probes
+            // about as far as one built from its final items alone.
+            auto fresh = adt::RobinHoodHashTable<int, int>();
+            for (auto const& [key, data] : reference)
+            {
+                fresh.insert(key, data);
+            }
+            auto const churned = table.getProbeLengthStatistics();
+            auto const built = fresh.getProbeLengthStatistics();
+            this->assert_true(churned.max_ <= built.max_ + 1, "Churn doesn't lengthen the longest probe.");
+            this->assert_true(churned.mean_ <= built.mean_ + 0.25, "Churn doesn't lengthen probes on average.");
+
+            // 7000 items leave the table of 8192 slots close to its maximal load.
+            for (auto key = 0; key < 7'000; ++key)
+            {
+                if (reference.count(key) == 0)
+                {
+                    table.insert(key, key);
+                }
+            }
+            auto const statistics = table.getProbeLengthStatistics();
+            this->info("Load factor " + std::to_string(table.getLoadFactor())
+                + ", mean probe length " + std::to_string(statistics.mean_)
+                + ", variance " + std::to_string(statistics.variance_)
+                + ", max " + std::to_string(statistics.max_) + ".");
+            this->assert_true(statistics.mean_ < 4.0, "Mean probe length stays short.");
+            this->assert_true(statistics.variance_ < 16.0, "Probe lengths stay close to each other.");
+            this->assert_true(statistics.max_ < 64, "Longest probe stays bounded.");
+        }
+    };
+
+    /**
+     * @brief Tests rank and select of an AVL tree against a sorted reference while keys are inserted
+     * in sorted order and then removed in random order.
+     */
+    class AVLTreeTestOrderStatistics : public details::TableTestBase<adt::AVLTree<int, int>>
+    {
+    public:
+        AVLTreeTestOrderStatistics() :
+            details::TableTestBase<adt::AVLTree<int, int>>("order-statistics", 50)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto constexpr n = 4'000;
+            auto tree = adt::AVLTree<int, int>();
+            auto reference = std::vector<int>();
+            for (auto key = 0; key < n; ++key)
+            {
+                tree.insert(2 * key, key);
+                reference.push_back(2 * key);
+            }
+            this->assert_true(matches(tree, reference), "Rank and select match after sorted inserts.");
+
+            for (auto const key : this->generateKeys(n / 2))
+            {
+                tree.remove(2 * key);
+                reference.erase(std::lower_bound(reference.begin(), reference.end(), 2 * key));
+            }
+            this->assert_equals(reference.size(), tree.size());
+            this->assert_true(matches(tree, reference), "Rank and select match after random removes.");
+
+            auto copy = adt::AVLTree<int, int>(tree);
+            this->assert_true(copy.equals(tree), "Copy equals the tree.");
+            this->assert_true(matches(copy, reference), "Rank and select match in the copy.");
+            this->assert_throws([&]()
+                {
+                    tree.select(tree.size());
+                }, "Select past the last item throws.");
+        }
+
+    private:
+        static bool matches(const adt::AVLTree<int, int>& tree, const std::vector<int>& reference)
+        {
+            for (size_t i = 0; i < reference.size(); ++i)
+            {
+                auto const key = reference[i];
+                if (tree.select(i).key_ != key || tree.rank(key) != i || tree.rank(key + 1) != i + 1)
+                {
+                    return false;
+                }
+            }
+            return tree.rank(-1) == 0;
+        }
+    };
+
     /**
      * @brief All table leaf tests
      * @tparam TableT table ty[e
@@ -501,6 +1161,91 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief SortedSequenceTable tests
+     */
+    class SortedSequenceTableTest : public GeneralTableTest<adt::SortedSequenceTable<int, int>>
+    {
+    public:
+        SortedSequenceTableTest() :
+            GeneralTableTest<adt::SortedSequenceTable<int, int>>("SortedSequenceTable")
+        {
+            this->add_test(std::make_unique<SortedSequenceTableTestBuild>());
+            this->add_test(std::make_unique<TableTestRange<adt::SortedSequenceTable<int, int>>>());
+        }
+    };
+
+    /**
+     * @brief HashTable tests
+     */
+    class HashTableTest : public GeneralTableTest<adt::HashTable<int, int>>
+    {
+    public:
+        HashTableTest() :
+            GeneralTableTest<adt::HashTable<int, int>>("HashTable")
+        {
+            this->add_test(std::make_unique<HashTableTestResize>());
+            this->add_test(std::make_unique<HashTableTestIncrementalRehash>());
+            this->add_test(std::make_unique<HashTableTestStringKeys>());
+            this->add_test(std::make_unique<HashTableTestFindBatch<adt::HashTable<int, int>>>());
+        }
+    };
+
+    /**
+     * @brief FlatHashTable tests
+     */
+    class FlatHashTableTest : public GeneralTableTest<adt::FlatHashTable<int, int>>
+    {
+    public:
+        FlatHashTableTest() :
+            GeneralTableTest<adt::FlatHashTable<int, int>>("FlatHashTable")
+        {
+            this->add_test(std::make_unique<FlatHashTableTestChurn>());
+            this->add_test(std::make_unique<HashTableTestFindBatch<adt::FlatHashTable<int, int>>>());
+        }
+    };
+
+    /**
+     * @brief RobinHoodHashTable tests
+     */
+    class RobinHoodHashTableTest : public GeneralTableTest<adt::RobinHoodHashTable<int, int>>
+    {
+    public:
+        RobinHoodHashTableTest() :
+            GeneralTableTest<adt::RobinHoodHashTable<int, int>>("RobinHoodHashTable")
+        {
+            this->add_test(std::make_unique<RobinHoodHashTableTestProbeLength>());
+            this->add_test(std::make_unique<HashTableTestFindBatch<adt::RobinHoodHashTable<int, int>>>());
+        }
+    };
+
+    /**
+     * @brief BinarySearchTree tests
+     */
+    class BinarySearchTreeTest : public GeneralTableTest<adt::BinarySearchTree<int, int>>
+    {
+    public:
+        BinarySearchTreeTest() :
+            GeneralTableTest<adt::BinarySearchTree<int, int>>("BinarySearchTree")
+        {
+            this->add_test(std::make_unique<TableTestRange<adt::BinarySearchTree<int, int>>>());
+        }
+    };
+
+    /**
+     * @brief AVLTree tests
+     */
+    class AVLTreeTest : public GeneralTableTest<adt::AVLTree<int, int>>
+    {
+    public:
+        AVLTreeTest() :
+            GeneralTableTest<adt::AVLTree<int, int>>("AVLTree")
+        {
+            this->add_test(std::make_unique<TableTestRange<adt::AVLTree<int, int>>>());
+            this->add_test(std::make_unique<AVLTreeTestOrderStatistics>());
+        }
+    };
+
     /**
      * @brief All sequence table implementations tests
      */
@@ -512,7 +1257,8 @@ namespace ds::tests
         {
             this->add_test(std::make_unique<GeneralTableTest<adt::UnsortedImplicitSequenceTable<int, int>>>("UnsortedImplicitSequenceTable"));
             this->add_test(std::make_unique<GeneralTableTest<adt::UnsortedExplicitSequenceTable<int, int>>>("UnsortedExplicitSequenceTable"));
-            this->add_test(std::make_unique<GeneralTableTest<adt::SortedSequenceTable<int, int>>>("SortedSequenceTable"));
+            this->add_test(std::make_unique<SortedSequenceTableTest>());
+            this->add_test(std::make_unique<FrozenSortedTableTest>());
         }
     };
 
@@ -525,9 +1271,12 @@ namespace ds::tests
         NonSequenceTableTest() :
             CompositeTest("NonSequenceTable")
         {
-            this->add_test(std::make_unique<GeneralTableTest<adt::HashTable<int, int>>>("HashTable"));
-            this->add_test(std::make_unique<GeneralTableTest<adt::BinarySearchTree<int, int>>>("BinarySearchTree"));
+            this->add_test(std::make_unique<HashTableTest>());
+            this->add_test(std::make_unique<FlatHashTableTest>());
+            this->add_test(std::make_unique<RobinHoodHashTableTest>());
+            this->add_test(std::make_unique<BinarySearchTreeTest>());
             this->add_test(std::make_unique<GeneralTableTest<adt::Treap<int, int>>>("Treap"));
+            this->add_test(std::make_unique<AVLTreeTest>());
         }
     };
 
@@ -542,10 +1291,14 @@ namespace ds::tests
         {
             this->add_test(std::make_unique<GeneralTableTest<adt::UnsortedImplicitSequenceTable<int, int>>>("UnsortedImplicitSequenceTable"));
             this->add_test(std::make_unique<GeneralTableTest<adt::UnsortedExplicitSequenceTable<int, int>>>("UnsortedExplicitSequenceTable"));
-            this->add_test(std::make_unique<GeneralTableTest<adt::SortedSequenceTable<int, int>>>("SortedSequenceTable"));
-            this->add_test(std::make_unique<GeneralTableTest<adt::HashTable<int, int>>>("HashTable"));
-            this->add_test(std::make_unique<GeneralTableTest<adt::BinarySearchTree<int, int>>>("BinarySearchTree"));
+            this->add_test(std::make_unique<SortedSequenceTableTest>());
+            this->add_test(std::make_unique<FrozenSortedTableTest>());
+            this->add_test(std::make_unique<HashTableTest>());
+            this->add_test(std::make_unique<FlatHashTableTest>());
+            this->add_test(std::make_unique<RobinHoodHashTableTest>());
+            this->add_test(std::make_unique<BinarySearchTreeTest>());
             this->add_test(std::make_unique<GeneralTableTest<adt::Treap<int, int>>>("Treap"));
+            this->add_test(std::make_unique<AVLTreeTest>());
         }
     };
 }
\ No newline at end of file
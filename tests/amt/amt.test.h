@@ -5,7 +5,10 @@
 #include <tests/amt/explicit_sequence.test.h>
 #include <tests/amt/implicit_hierarchy.test.h>
 #include <tests/amt/explicit_hierarchy.test.h>
+#include <tests/amt/frozen_hierarchy.test.h>
 #include <tests/amt/hierarchy.test.h>
+#include <tests/amt/explicit_network.test.h>
+#include <tests/amt/frozen_network.test.h>
 #include <memory>
 
 namespace ds::tests
@@ -20,7 +23,10 @@ namespace ds::tests
             this->add_test(std::make_unique<ExplicitSequenceTest>());
             this->add_test(std::make_unique<ImplicitHierarchyTest>());
             this->add_test(std::make_unique<ExplicitHierarchyTest>());
+            this->add_test(std::make_unique<FrozenHierarchyTest>());
             this->add_test(std::make_unique<HierarchyTest>());
+            this->add_test(std::make_unique<ExplicitNetworkTest>());
+            this->add_test(std::make_unique<FrozenNetworkTest>());
         }
     };
 }
@@ -3,8 +3,10 @@
 #include <libds/amt/explicit_hierarchy.h>
 #include <tests/_details/test.hpp>
 #include <tests/amt/hierarchy.test.h>
+#include <tests/amt/sequence.test.h>
 #include <memory>
 #include <type_traits>
+#include <vector>
 
 namespace ds::tests
 {
@@ -245,6 +247,494 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests insertion of root and sons at arbitrary positions.
+     */
+    class MWSEHTestInsert : public LeafTest
+    {
+    public:
+        MWSEHTestInsert() :
+            LeafTest("insert")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeMWSEH();
+            auto& hierarchy = *fixture.hierarchy_;
+            /*        0
+             *   /         \
+             *   1         2
+             * / | \       |
+             * 3 4 5       6
+             */
+
+            this->assert_equals(static_cast<size_t>(7), hierarchy.size());
+
+            auto& root = *hierarchy.accessRoot();
+            hierarchy.emplaceSon(root, 2).data_ = 7;
+            hierarchy.emplaceSon(root, 1).data_ = 8;
+            this->assert_equals(static_cast<size_t>(4), hierarchy.degree(root));
+            this->assert_equals(8, hierarchy.accessSon(root, 1)->data_);
+            this->assert_equals(2, hierarchy.accessSon(root, 2)->data_);
+            this->assert_equals(7, hierarchy.accessSon(root, 3)->data_);
+            this->assert_throws([&]() { hierarchy.emplaceSon(root, 5); }, "Son can't be inserted past the last son.");
+        }
+    };
+
+    /**
+     *  @brief Tests access of parent and sons.
+     */
+    class MWSEHTestAccess : public LeafTest
+    {
+    public:
+        MWSEHTestAccess() :
+            LeafTest("access")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const auto emptyHierarchy = amt::MultiWaySiblingExplicitHierarchy<int>();
+            this->assert_null(emptyHierarchy.accessRoot());
+
+            auto fixture = details::makeMWSEH();
+            auto& hierarchy = *fixture.hierarchy_;
+            /*        0
+             *   /         \
+             *   1         2
+             * / | \       |
+             * 3 4 5       6
+             */
+
+            auto* root = hierarchy.accessRoot();
+            this->assert_not_null(root);
+            this->assert_equals(0, root->data_);
+
+            auto* one = hierarchy.accessSon(*root, 0);
+            this->assert_not_null(one);
+            this->assert_equals(1, one->data_);
+
+            auto* two = hierarchy.accessSon(*root, 1);
+            this->assert_not_null(two);
+            this->assert_equals(2, two->data_);
+
+            auto* five = hierarchy.accessSon(*one, 2);
+            this->assert_not_null(five);
+            this->assert_equals(5, five->data_);
+
+            this->assert_null(hierarchy.accessSon(*two, 1));
+            this->assert_null(hierarchy.accessSon(*five, 0));
+
+            this->assert_equals(one, hierarchy.accessParent(*five));
+            this->assert_equals(root, hierarchy.accessParent(*two));
+            this->assert_null(hierarchy.accessParent(*root));
+        }
+    };
+
+    /**
+     * @brief Tests method for calculation of node count, level and degree.
+     */
+    class MWSEHTestLevelsCountsDegs : public LeafTest
+    {
+    public:
+        MWSEHTestLevelsCountsDegs() :
+            LeafTest("level-count-degree")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeMWSEH();
+            auto& hierarchy = *fixture.hierarchy_;
+            /*        0
+             *   /         \
+             *   1         2
+             * / | \       |
+             * 3 4 5       6
+             */
+
+            auto& root = *hierarchy.accessRoot();
+            auto& one = *hierarchy.accessSon(root, 0);
+            auto& two = *hierarchy.accessSon(root, 1);
+            auto& six = *hierarchy.accessSon(two, 0);
+
+            this->assert_equals(static_cast<size_t>(7), hierarchy.nodeCount());
+            this->assert_equals(static_cast<size_t>(4), hierarchy.nodeCount(one));
+
+            this->assert_equals(static_cast<size_t>(0), hierarchy.level(root));
+            this->assert_equals(static_cast<size_t>(1), hierarchy.level(one));
+            this->assert_equals(static_cast<size_t>(2), hierarchy.level(six));
+
+            this->assert_equals(static_cast<size_t>(2), hierarchy.degree(root));
+            this->assert_equals(static_cast<size_t>(3), hierarchy.degree(one));
+            this->assert_equals(static_cast<size_t>(1), hierarchy.degree(two));
+            this->assert_equals(static_cast<size_t>(0), hierarchy.degree(six));
+        }
+    };
+
+    /**
+     *  @brief Tests change and removal of sons and sub-hierarchies.
+     */
+    class MWSEHTestChangeRemove : public LeafTest
+    {
+    public:
+        MWSEHTestChangeRemove() :
+            LeafTest("change-remove")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeMWSEH();
+            auto& hierarchy = *fixture.hierarchy_;
+            /*        0
+             *   /         \
+             *   1        x2
+             * / | \       |
+             * 3 4 5       6
+             *   x         ~
+             */
+            auto& root = *hierarchy.accessRoot();
+            auto& one = *hierarchy.accessSon(root, 0);
+
+            hierarchy.removeSon(one, 1);
+            hierarchy.removeSon(root, 1);
+
+            this->assert_equals(static_cast<size_t>(2), hierarchy.degree(one));
+            this->assert_equals(5, hierarchy.accessSon(one, 1)->data_);
+            this->assert_equals(static_cast<size_t>(1), hierarchy.degree(root));
+            this->assert_null(hierarchy.accessSon(root, 1));
+            this->assert_equals(static_cast<size_t>(4), hierarchy.size());
+
+            auto& three = *hierarchy.accessSon(one, 0);
+            hierarchy.changeSon(one, 0, nullptr);
+            this->assert_equals(static_cast<size_t>(1), hierarchy.degree(one));
+            this->assert_equals(5, hierarchy.accessSon(one, 0)->data_);
+            this->assert_null(hierarchy.accessParent(three));
+            this->assert_equals(static_cast<size_t>(3), hierarchy.size());
+
+            auto otherHierarchy = amt::MultiWaySiblingExplicitHierarchy<int>();
+            otherHierarchy.changeRoot(&three);
+            this->assert_equals(static_cast<size_t>(1), otherHierarchy.size());
+        }
+    };
+
+    /**
+     *  @brief Tests that changing a son to nullptr unlinks it, while the multi-way hierarchy keeps an empty slot.
+     */
+    class MWSEHTestChangeToNull : public LeafTest
+    {
+    public:
+        MWSEHTestChangeToNull() :
+            LeafTest("change-to-null")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            /*        0
+             *   /         \
+             *   1         2
+             * / | \       |
+             * 3 4 5       6
+             *   ~
+             */
+            auto siblingFixture = details::makeMWSEH();
+            auto& siblingHierarchy = *siblingFixture.hierarchy_;
+            auto& siblingOne = *siblingHierarchy.accessSon(*siblingHierarchy.accessRoot(), 0);
+            auto& siblingFour = *siblingHierarchy.accessSon(siblingOne, 1);
+
+            siblingHierarchy.changeSon(siblingOne, 1, nullptr);
+            this->assert_equals(static_cast<size_t>(2), siblingHierarchy.degree(siblingOne));
+            this->assert_equals(3, siblingHierarchy.accessSon(siblingOne, 0)->data_);
+            this->assert_equals(5, siblingHierarchy.accessSon(siblingOne, 1)->data_);
+            this->assert_null(siblingHierarchy.accessSon(siblingOne, 2));
+
+            auto multiWayFixture = details::makeMWEH();
+            auto& multiWayHierarchy = *multiWayFixture.hierarchy_;
+            auto& multiWayOne = *multiWayHierarchy.accessSon(*multiWayHierarchy.accessRoot(), 0);
+            auto& multiWayFour = *multiWayHierarchy.accessSon(multiWayOne, 1);
+
+            multiWayHierarchy.changeSon(multiWayOne, 1, nullptr);
+            this->assert_equals(static_cast<size_t>(3), multiWayHierarchy.degree(multiWayOne));
+            this->assert_equals(3, multiWayHierarchy.accessSon(multiWayOne, 0)->data_);
+            this->assert_null(multiWayHierarchy.accessSon(multiWayOne, 1));
+            this->assert_equals(5, multiWayHierarchy.accessSon(multiWayOne, 2)->data_);
+
+            multiWayHierarchy.changeSon(multiWayOne, 1, &multiWayFour);
+            this->assert_equals(static_cast<size_t>(7), multiWayHierarchy.size());
+
+            auto otherSiblingHierarchy = amt::MultiWaySiblingExplicitHierarchy<int>();
+            otherSiblingHierarchy.changeRoot(&siblingFour);
+            this->assert_equals(static_cast<size_t>(6), siblingHierarchy.size());
+        }
+    };
+
+    /**
+     *  @brief Tests copy constructor, assign and equals.
+     */
+    class MWSEHTestCopyAssignEquals : public LeafTest
+    {
+    public:
+        MWSEHTestCopyAssignEquals() :
+            LeafTest("copy-assign-equals")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeMWSEH();
+            auto& hierarchy1 = *fixture.hierarchy_;
+
+            auto& root1 = *hierarchy1.accessRoot();
+            auto& one1 = *hierarchy1.accessSon(root1, 0);
+
+            auto hierarchy2(hierarchy1);
+            this->assert_true(hierarchy1.equals(hierarchy2), "Copy constructed hierarchy is the same.");
+            hierarchy1.removeSon(root1, 1);
+            this->assert_false(hierarchy1.equals(hierarchy2), "Modified copy is different.");
+
+            auto hierarchy3 = amt::MultiWaySiblingExplicitHierarchy<int>();
+            hierarchy3.assign(hierarchy1);
+            this->assert_true(hierarchy1.equals(hierarchy3), "Assigned hierarchy is the same.");
+            hierarchy1.removeSon(one1, 0);
+            hierarchy1.removeSon(one1, 0);
+            this->assert_false(hierarchy1.equals(hierarchy3), "Modified assigned hierarchy is different.");
+        }
+    };
+
+    /**
+     *  @brief Tests clear.
+     */
+    class MWSEHTestClear : public LeafTest
+    {
+    public:
+        MWSEHTestClear() :
+            LeafTest("clear")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeMWSEH();
+            auto& hierarchy = *fixture.hierarchy_;
+
+            hierarchy.clear();
+
+            this->assert_equals(static_cast<size_t>(0), hierarchy.size());
+            this->assert_null(hierarchy.accessRoot());
+            this->assert_true(hierarchy.isEmpty(), "Cleared hierarchy is empty.");
+        }
+    };
+
+    /**
+     * @brief All MultiWaySiblingExplicitHierarchy tests.
+     */
+    class MultiWaySiblingExplicitHierarchyTest : public CompositeTest
+    {
+    public:
+        MultiWaySiblingExplicitHierarchyTest() :
+            CompositeTest("MultiWaySiblingExplicitHierarchy")
+        {
+            this->add_test(std::make_unique<MWSEHTestInsert>());
+            this->add_test(std::make_unique<MWSEHTestAccess>());
+            this->add_test(std::make_unique<MWSEHTestLevelsCountsDegs>());
+            this->add_test(std::make_unique<MWSEHTestChangeRemove>());
+            this->add_test(std::make_unique<MWSEHTestChangeToNull>());
+            this->add_test(std::make_unique<MWSEHTestCopyAssignEquals>());
+            this->add_test(std::make_unique<MWSEHTestClear>());
+        }
+    };
+
+    /**
+     *  @brief Tests that subtree sizes of a multi-way hierarchy follow its modifications.
+     */
+    class AugmentedMWEHTestSubtreeSizes : public LeafTest
+    {
+    public:
+        AugmentedMWEHTestSubtreeSizes() :
+            LeafTest("multiway-subtree-sizes")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto hierarchy = amt::AugmentedMultiWayExplicitHierarchy<int>();
+            this->assert_equals(static_cast<size_t>(0), hierarchy.size());
+            /*        0
+             *   /         \
+             *   1         2
+             * / | \       |
+             * 3 4 5       6
+             */
+            auto& root = hierarchy.emplaceRoot();
+            auto& one = hierarchy.emplaceSon(root, 0);
+            auto& two = hierarchy.emplaceSon(root, 1);
+            hierarchy.emplaceSon(one, 0);
+            hierarchy.emplaceSon(one, 1);
+            hierarchy.emplaceSon(one, 2);
+            auto& six = hierarchy.emplaceSon(two, 0);
+
+            this->assert_equals(static_cast<size_t>(7), hierarchy.size());
+            this->assert_equals(static_cast<size_t>(7), hierarchy.nodeCount());
+            this->assert_equals(static_cast<size_t>(4), hierarchy.nodeCount(one));
+            this->assert_equals(static_cast<size_t>(2), hierarchy.nodeCount(two));
+            this->assert_equals(static_cast<size_t>(1), hierarchy.nodeCount(six));
+
+            auto copy = hierarchy;
+            this->assert_true(hierarchy.equals(copy), "Copy is the same.");
+            this->assert_equals(static_cast<size_t>(4), copy.nodeCount(*copy.accessSon(*copy.accessRoot(), 0)));
+
+            hierarchy.removeSon(one, 1);
+            this->assert_equals(static_cast<size_t>(3), hierarchy.nodeCount(one));
+            this->assert_equals(static_cast<size_t>(6), hierarchy.size());
+
+            auto other = amt::AugmentedMultiWayExplicitHierarchy<int>();
+            auto& otherRoot = other.emplaceRoot();
+            other.emplaceSon(otherRoot, 0);
+            other.emplaceSon(otherRoot, 1);
+            other.changeRoot(nullptr);
+            hierarchy.changeSon(root, 1, &otherRoot);
+            this->assert_equals(static_cast<size_t>(7), hierarchy.size());
+            other.changeRoot(&two);
+            this->assert_equals(static_cast<size_t>(2), other.size());
+
+            hierarchy.emplaceSon(one, 2);
+            this->assert_equals(static_cast<size_t>(4), hierarchy.nodeCount(one));
+            this->assert_equals(static_cast<size_t>(8), hierarchy.size());
+        }
+    };
+
+    /**
+     *  @brief Tests subtree sizes, heights and in-order positions of a binary hierarchy.
+     */
+    class AugmentedBEHTestOrderStatistics : public LeafTest
+    {
+    public:
+        AugmentedBEHTestOrderStatistics() :
+            LeafTest("binary-order-statistics")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto hierarchy = amt::AugmentedBinaryExplicitHierarchy<int>();
+            this->assert_null(hierarchy.accessInOrder(0));
+            /*         10
+             *    /          \
+             *    5          15
+             *  /   \      /   \
+             *  2   7      -   20
+             */
+            auto& root = hierarchy.emplaceRoot();
+            auto& five = hierarchy.insertLeftSon(root);
+            auto& fifteen = hierarchy.insertRightSon(root);
+            auto& two = hierarchy.insertLeftSon(five);
+            auto& seven = hierarchy.insertRightSon(five);
+            auto& twenty = hierarchy.insertRightSon(fifteen);
+            root.data_ = 10;
+            five.data_ = 5;
+            fifteen.data_ = 15;
+            two.data_ = 2;
+            seven.data_ = 7;
+            twenty.data_ = 20;
+
+            this->assert_equals(static_cast<size_t>(6), hierarchy.size());
+            this->assert_equals(static_cast<size_t>(3), hierarchy.nodeCount(five));
+            this->assert_equals(static_cast<size_t>(2), hierarchy.nodeCount(fifteen));
+            this->assert_equals(static_cast<size_t>(3), hierarchy.height(&root));
+            this->assert_equals(static_cast<size_t>(2), hierarchy.height(&fifteen));
+            this->assert_equals(static_cast<size_t>(1), hierarchy.height(&twenty));
+            this->assert_equals(static_cast<size_t>(0), hierarchy.height(nullptr));
+
+            auto const inOrder = std::vector<int>({2, 5, 7, 10, 15, 20});
+            for (size_t i = 0; i < inOrder.size(); ++i)
+            {
+                auto* node = hierarchy.accessInOrder(i);
+                this->assert_not_null(node);
+                this->assert_equals(inOrder[i], node->data_);
+                this->assert_equals(i, hierarchy.calculateInOrderIndex(*node));
+            }
+            this->assert_null(hierarchy.accessInOrder(inOrder.size()));
+
+            hierarchy.removeLeftSon(root);
+            this->assert_equals(static_cast<size_t>(3), hierarchy.size());
+            this->assert_equals(static_cast<size_t>(3), hierarchy.height(&root));
+            this->assert_equals(10, hierarchy.accessInOrder(0)->data_);
+            this->assert_equals(static_cast<size_t>(2), hierarchy.calculateInOrderIndex(twenty));
+
+            hierarchy.changeRightSon(root, nullptr);
+            this->assert_equals(static_cast<size_t>(1), hierarchy.size());
+            this->assert_equals(static_cast<size_t>(1), hierarchy.height(&root));
+            hierarchy.changeLeftSon(root, &fifteen);
+            this->assert_equals(static_cast<size_t>(3), hierarchy.size());
+            this->assert_equals(static_cast<size_t>(3), hierarchy.height(&root));
+            this->assert_equals(20, hierarchy.accessInOrder(1)->data_);
+        }
+    };
+
+    /**
+     * @brief Tests that sons created through the ExplicitHierarchy base keep the sizes up to date.
+     * @tparam Hierarchy Tested augmented hierarchy type with int data.
+     */
+    template<class Hierarchy>
+    class AugmentedEHTestThroughBase : public LeafTest
+    {
+    public:
+        explicit AugmentedEHTestThroughBase(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto hierarchy = Hierarchy();
+            amt::ExplicitHierarchy<typename Hierarchy::BlockType>& base = hierarchy;
+            auto& root = base.emplaceRoot();
+            base.emplaceSon(root, 0);
+            auto& son = base.emplaceSon(root, 1, 42);
+            base.emplaceSon(son, 0, 43);
+
+            this->assert_equals(42, son.data_);
+            this->assert_equals(static_cast<size_t>(4), base.size());
+            this->assert_equals(static_cast<size_t>(4), hierarchy.size());
+            this->assert_equals(static_cast<size_t>(4), hierarchy.nodeCount(root));
+            this->assert_equals(static_cast<size_t>(2), hierarchy.nodeCount(son));
+
+            auto copy = Hierarchy(hierarchy);
+            this->assert_true(hierarchy.equals(copy), "Copy is the same.");
+            this->assert_equals(static_cast<size_t>(4), copy.size());
+            this->assert_equals(static_cast<size_t>(2), copy.nodeCount(*copy.accessSon(*copy.accessRoot(), 1)));
+        }
+    };
+
+    /**
+     * @brief All augmented explicit hierarchy tests.
+     */
+    class AugmentedExplicitHierarchyTest : public CompositeTest
+    {
+    public:
+        AugmentedExplicitHierarchyTest() :
+            CompositeTest("AugmentedExplicitHierarchy")
+        {
+            this->add_test(std::make_unique<AugmentedMWEHTestSubtreeSizes>());
+            this->add_test(std::make_unique<AugmentedBEHTestOrderStatistics>());
+            this->add_test(std::make_unique<AugmentedEHTestThroughBase<amt::AugmentedMultiWayEH<int>>>("multiway-through-base"));
+            this->add_test(std::make_unique<AugmentedEHTestThroughBase<amt::AugmentedBinaryEH<int>>>("binary-through-base"));
+        }
+    };
+
     /**
      * @brief Tests insertion of root and sons.
      */
@@ -523,6 +1013,65 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests that emplaceRoot and emplaceSon construct the data in place.
+     * @tparam Hierarchy Tested hierarchy type with details::EmplaceCounted data.
+     */
+    template<class Hierarchy>
+    class EHTestEmplace : public LeafTest
+    {
+    public:
+        explicit EHTestEmplace(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using details::EmplaceCounted;
+
+            EmplaceCounted::resetCounters();
+            Hierarchy hierarchy;
+            auto& root = hierarchy.emplaceRoot(0, 1);
+            auto& son0 = hierarchy.emplaceSon(root, 0, 10, 11);
+            auto& son1 = hierarchy.emplaceSon(root, 1, 20, 21);
+            hierarchy.emplaceSon(son0, 0, 30, 31);
+
+            this->assert_true(root.data_ == EmplaceCounted(0, 1), "Root is constructed from arguments.");
+            this->assert_true(son1.data_ == EmplaceCounted(20, 21), "Son is constructed from arguments.");
+            this->assert_equals(&root, hierarchy.accessParent(son1));
+            this->assert_equals(&son0, hierarchy.accessParent(*hierarchy.accessSon(son0, 0)));
+            this->assert_equals(static_cast<size_t>(2), hierarchy.degree(root));
+            this->assert_equals(static_cast<size_t>(4), hierarchy.size());
+
+            Hierarchy copy(hierarchy);
+            this->assert_true(hierarchy.equals(copy), "Copy constructed hierarchy is the same.");
+
+            this->assert_equals(static_cast<size_t>(0), EmplaceCounted::defaultConstructions_);
+            this->assert_equals(static_cast<size_t>(0), EmplaceCounted::assignments_);
+        }
+    };
+
+    /**
+     * @brief Emplace tests of all explicit hierarchies.
+     */
+    class EHEmplaceTest : public CompositeTest
+    {
+    public:
+        EHEmplaceTest() :
+            CompositeTest("Emplace")
+        {
+            using details::EmplaceCounted;
+            this->add_test(std::make_unique<EHTestEmplace<amt::MultiWayEH<EmplaceCounted>>>("multi-way"));
+            this->add_test(std::make_unique<EHTestEmplace<amt::MultiWaySiblingEH<EmplaceCounted>>>("multi-way-sibling"));
+            this->add_test(std::make_unique<EHTestEmplace<amt::KWayEH<EmplaceCounted, 3>>>("k-way"));
+            this->add_test(std::make_unique<EHTestEmplace<amt::BinaryEH<EmplaceCounted>>>("binary"));
+            this->add_test(std::make_unique<EHTestEmplace<amt::AugmentedMultiWayEH<EmplaceCounted>>>("augmented-multi-way"));
+            this->add_test(std::make_unique<EHTestEmplace<amt::AugmentedBinaryEH<EmplaceCounted>>>("augmented-binary"));
+        }
+    };
+
     /**
      * @brief All ExplicitHierarchy tests.
      */
@@ -533,7 +1082,10 @@ namespace ds::tests
             CompositeTest("ExplicitHierarchy")
         {
             this->add_test(std::make_unique<MultiwayExplicitHierarchyTest>());
+            this->add_test(std::make_unique<MultiWaySiblingExplicitHierarchyTest>());
             this->add_test(std::make_unique<KWayExplicitHierarchyTest>());
+            this->add_test(std::make_unique<AugmentedExplicitHierarchyTest>());
+            this->add_test(std::make_unique<EHEmplaceTest>());
         }
     };
 }
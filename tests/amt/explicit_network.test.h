@@ -0,0 +1,279 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/amt/explicit_network.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests copy constructor, assign and equals of a network.
+     * @tparam Network Tested network type.
+     */
+    template<class Network>
+    class NetworkTestCopyAssignEquals : public LeafTest
+    {
+    public:
+        explicit NetworkTestCopyAssignEquals(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            // 0 - 1 - 2
+            // |     / |
+            // 3 - 4   5
+            Network network1;
+            using NodeType = typename Network::NodeType;
+            NodeType* nodes[6];
+            for (int i = 0; i < 6; ++i)
+            {
+                nodes[i] = &network1.insert();
+                nodes[i]->data_ = i;
+            }
+            network1.connect(*nodes[0], *nodes[1]);
+            network1.connect(*nodes[1], *nodes[2]);
+            network1.connect(*nodes[0], *nodes[3]);
+            network1.connect(*nodes[3], *nodes[4]);
+            network1.connect(*nodes[2], *nodes[4]);
+            network1.connect(*nodes[2], *nodes[5]);
+
+            Network network2(network1);
+            this->assert_equals(static_cast<size_t>(6), network2.size());
+            this->assert_equals(network1.relationCount(), network2.relationCount());
+            this->assert_true(network1.equals(network2), "Copy constructed network is the same.");
+
+            NodeType* copies[6];
+            int i = 0;
+            for (NodeType* node : network2)
+            {
+                copies[i++] = node;
+            }
+            this->assert_equals(2, copies[2]->data_);
+            this->assert_equals(static_cast<size_t>(3), network2.degree(*copies[2]));
+            std::vector<int> neighbours;
+            copies[2]->relations_->processAllBlocksForward([&neighbours](auto* b)
+                {
+                    neighbours.push_back(b->data_->data_);
+                });
+            this->assert_true(neighbours == std::vector<int>({1, 4, 5}), "Relations keep their order.");
+            this->assert_true(network2.relationExists(*copies[2], *copies[5]), "Copied relation exists.");
+            this->assert_false(network2.relationExists(*copies[2], *nodes[5]), "Copy doesn't point into the original.");
+
+            copies[3]->data_ = 10;
+            this->assert_false(network1.equals(network2), "Network with different data is different.");
+
+            Network network3;
+            network3.assign(network1);
+            this->assert_true(network1.equals(network3), "Assigned network is the same.");
+            i = 0;
+            for (NodeType* node : network3)
+            {
+                copies[i++] = node;
+            }
+            network3.disconnect(*copies[2], *copies[4]);
+            network3.connect(*copies[2], *copies[3]);
+            this->assert_equals(network1.relationCount(), network3.relationCount());
+            this->assert_false(network1.equals(network3), "Network with different relations is different.");
+
+            network3.assign(network1);
+            this->assert_true(network1.equals(network3), "Reassigned network is the same.");
+            network3.clear();
+            this->assert_true(network3.isEmpty(), "Cleared network is empty.");
+            this->assert_false(network1.equals(network3), "Empty network is different.");
+        }
+    };
+
+    /**
+     * @brief Tests connect, disconnect, relationExists and remove of a network.
+     * @tparam Network Tested network type.
+     */
+    template<class Network>
+    class NetworkTestRelations : public LeafTest
+    {
+    public:
+        explicit NetworkTestRelations(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            // star around the hub with a ring on the leaves
+            Network network;
+            using NodeType = typename Network::NodeType;
+            NodeType& hub = network.insert();
+            hub.data_ = -1;
+            NodeType* leaves[8];
+            for (int i = 0; i < 8; ++i)
+            {
+                leaves[i] = &network.insert();
+                leaves[i]->data_ = i;
+                network.connect(hub, *leaves[i]);
+            }
+            for (int i = 0; i < 8; ++i)
+            {
+                network.connect(*leaves[i], *leaves[(i + 1) % 8]);
+            }
+            this->assert_equals(static_cast<size_t>(32), network.relationCount());
+            this->assert_true(network.relationExists(hub, *leaves[5]), "Relation from the hub exists.");
+            this->assert_true(network.relationExists(*leaves[0], *leaves[7]), "Ring relation exists.");
+            this->assert_false(network.relationExists(*leaves[0], *leaves[2]), "Missing relation doesn't exist.");
+
+            network.disconnect(*leaves[3], hub);
+            this->assert_false(network.relationExists(hub, *leaves[3]), "Disconnected relation doesn't exist.");
+            this->assert_false(network.relationExists(*leaves[3], hub), "Relation is removed in both directions.");
+            this->assert_equals(static_cast<size_t>(7), network.degree(hub));
+            this->assert_equals(static_cast<size_t>(2), network.degree(*leaves[3]));
+
+            std::vector<int> neighbours;
+            hub.relations_->processAllBlocksForward([&neighbours](auto* b)
+                {
+                    neighbours.push_back(b->data_->data_);
+                });
+            this->assert_true(neighbours == std::vector<int>({0, 1, 2, 4, 5, 6, 7}), "Remaining relations keep their order.");
+
+            network.connect(*leaves[0], *leaves[1]);
+            network.disconnect(*leaves[1], *leaves[0]);
+            this->assert_true(network.relationExists(*leaves[0], *leaves[1]), "Parallel relation survives disconnect.");
+
+            network.remove(&hub);
+            this->assert_equals(static_cast<size_t>(8), network.size());
+            this->assert_equals(static_cast<size_t>(16), network.relationCount());
+            for (int i = 0; i < 8; ++i)
+            {
+                this->assert_equals(static_cast<size_t>(2), network.degree(*leaves[i]));
+            }
+        }
+    };
+
+    /**
+     * @brief Tests remove and removeWithProperty of a network.
+     * @tparam Network Tested network type.
+     */
+    template<class Network>
+    class NetworkTestRemove : public LeafTest
+    {
+    public:
+        explicit NetworkTestRemove(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        using NodeType = typename Network::NodeType;
+
+        void test() override
+        {
+            // chain 0 - 1 - ... - 9 with shortcuts i - (i + 2) and 0 - 5
+            Network network;
+            NodeType* nodes[10];
+            for (int i = 0; i < 10; ++i)
+            {
+                nodes[i] = &network.insert();
+                nodes[i]->data_ = i;
+            }
+            for (int i = 0; i < 9; ++i)
+            {
+                network.connect(*nodes[i], *nodes[i + 1]);
+            }
+            for (int i = 0; i < 8; ++i)
+            {
+                network.connect(*nodes[i], *nodes[i + 2]);
+            }
+            network.connect(*nodes[0], *nodes[5]);
+            this->checkGate(network, "Gate references are set by insert.");
+
+            network.remove(nodes[0]);
+            this->assert_equals(static_cast<size_t>(9), network.size());
+            this->assert_equals(static_cast<size_t>(30), network.relationCount());
+            this->assert_true(this->sortedData(network) == std::vector<int>({1, 2, 3, 4, 5, 6, 7, 8, 9}), "Removed node is not in the gate.");
+            this->checkGate(network, "Gate references are valid after remove.");
+
+            this->assert_equals(static_cast<size_t>(0), network.removeWithProperty([](NodeType*) { return false; }));
+            this->assert_equals(static_cast<size_t>(9), network.size());
+
+            this->assert_equals(static_cast<size_t>(4), network.removeWithProperty([](NodeType* node) { return node->data_ % 2 == 0; }));
+            this->assert_true(this->sortedData(network) == std::vector<int>({1, 3, 5, 7, 9}), "Even nodes are removed.");
+            this->assert_equals(static_cast<size_t>(8), network.relationCount());
+            this->assert_true(network.relationExists(*nodes[3], *nodes[5]), "Relation between kept nodes exists.");
+            this->assert_equals(static_cast<size_t>(2), network.degree(*nodes[5]));
+            this->assert_equals(static_cast<size_t>(1), network.degree(*nodes[1]));
+            this->assert_equals(static_cast<size_t>(1), network.degree(*nodes[9]));
+            this->checkGate(network, "Gate references are valid after bulk remove.");
+
+            network.disconnect(*nodes[5], *nodes[7]);
+            network.remove(nodes[9]);
+            this->assert_equals(static_cast<size_t>(0), network.degree(*nodes[7]));
+            this->checkGate(network, "Gate references are valid after removing the last node.");
+
+            this->assert_equals(static_cast<size_t>(4), network.removeWithProperty([](NodeType*) { return true; }));
+            this->assert_true(network.isEmpty(), "Network without nodes is empty.");
+            this->assert_equals(static_cast<size_t>(0), network.relationCount());
+
+            network.insert().data_ = 42;
+            this->assert_equals(static_cast<size_t>(1), network.size());
+            this->checkGate(network, "Gate references are valid after insert into emptied network.");
+        }
+
+    private:
+        std::vector<int> sortedData(const Network& network)
+        {
+            std::vector<int> result;
+            for (NodeType* node : network)
+            {
+                result.push_back(node->data_);
+            }
+            std::sort(result.begin(), result.end());
+            return result;
+        }
+
+        void checkGate(const Network& network, const std::string& message)
+        {
+            bool valid = true;
+            size_t index = 0;
+            for (NodeType* node : network)
+            {
+                valid = valid && (node->gate_.block_ != nullptr ? node->gate_.block_->data_ == node : node->gate_.index_ == index);
+                ++index;
+            }
+            this->assert_true(valid, message);
+        }
+    };
+
+    /**
+     * @brief Tests for all explicit networks.
+     */
+    class ExplicitNetworkTest : public CompositeTest
+    {
+    public:
+        ExplicitNetworkTest() :
+            CompositeTest("ExplicitNetwork")
+        {
+            this->add_test(std::make_unique<NetworkTestCopyAssignEquals<amt::IGIRNetwork<int>>>("igir-copy-assign-equals"));
+            this->add_test(std::make_unique<NetworkTestCopyAssignEquals<amt::IGERNetwork<int>>>("iger-copy-assign-equals"));
+            this->add_test(std::make_unique<NetworkTestCopyAssignEquals<amt::EGIRNetwork<int>>>("egir-copy-assign-equals"));
+            this->add_test(std::make_unique<NetworkTestCopyAssignEquals<amt::EGERNetwork<int>>>("eger-copy-assign-equals"));
+            this->add_test(std::make_unique<NetworkTestCopyAssignEquals<amt::IGHRNetwork<int>>>("ighr-copy-assign-equals"));
+            this->add_test(std::make_unique<NetworkTestCopyAssignEquals<amt::EGHRNetwork<int>>>("eghr-copy-assign-equals"));
+            this->add_test(std::make_unique<NetworkTestRelations<amt::IGIRNetwork<int>>>("igir-relations"));
+            this->add_test(std::make_unique<NetworkTestRelations<amt::IGERNetwork<int>>>("iger-relations"));
+            this->add_test(std::make_unique<NetworkTestRelations<amt::EGIRNetwork<int>>>("egir-relations"));
+            this->add_test(std::make_unique<NetworkTestRelations<amt::EGERNetwork<int>>>("eger-relations"));
+            this->add_test(std::make_unique<NetworkTestRelations<amt::IGHRNetwork<int>>>("ighr-relations"));
+            this->add_test(std::make_unique<NetworkTestRelations<amt::EGHRNetwork<int>>>("eghr-relations"));
+            this->add_test(std::make_unique<NetworkTestRemove<amt::IGIRNetwork<int>>>("igir-remove"));
+            this->add_test(std::make_unique<NetworkTestRemove<amt::IGERNetwork<int>>>("iger-remove"));
+            this->add_test(std::make_unique<NetworkTestRemove<amt::EGIRNetwork<int>>>("egir-remove"));
+            this->add_test(std::make_unique<NetworkTestRemove<amt::EGERNetwork<int>>>("eger-remove"));
+            this->add_test(std::make_unique<NetworkTestRemove<amt::IGHRNetwork<int>>>("ighr-remove"));
+            this->add_test(std::make_unique<NetworkTestRemove<amt::EGHRNetwork<int>>>("eghr-remove"));
+        }
+    };
+}
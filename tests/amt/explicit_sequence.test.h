@@ -17,6 +17,7 @@ namespace ds::tests
             CompositeTest("SinglyLinkedSequence")
         {
             this->add_test(std::make_unique<GenericSequenceTest<amt::SinglyLinkedSequence<int>>>());
+            this->add_test(std::make_unique<SequenceTestEmplaceInPlace<amt::SinglyLinkedSequence>>());
         }
     };
 
@@ -30,6 +31,7 @@ namespace ds::tests
             CompositeTest("DoublyLinkedSequence")
         {
             this->add_test(std::make_unique<GenericSequenceTest<amt::DoublyLinkedSequence<int>>>());
+            this->add_test(std::make_unique<SequenceTestEmplaceInPlace<amt::DoublyLinkedSequence>>());
         }
     };
 
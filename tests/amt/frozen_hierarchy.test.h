@@ -0,0 +1,215 @@
+#pragma once
+
+#include <libds/amt/frozen_hierarchy.h>
+#include <tests/_details/test.hpp>
+#include <tests/amt/hierarchy.test.h>
+#include <memory>
+
+namespace ds::tests
+{
+    /**
+     *  @brief Tests that freezing preserves the shape and the pre-order layout.
+     */
+    class FrozenHierarchyTestFreeze : public LeafTest
+    {
+    public:
+        FrozenHierarchyTestFreeze() :
+            LeafTest("freeze")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const auto emptyHierarchy = amt::freeze(amt::MultiWayExplicitHierarchy<int>());
+            this->assert_null(emptyHierarchy.accessRoot());
+            this->assert_true(emptyHierarchy.isEmpty(), "Frozen empty hierarchy is empty.");
+
+            auto fixture = details::makeMWEH();
+            auto hierarchy = amt::freeze(*fixture.hierarchy_);
+            /*        0
+             *   /         \
+             *   1         2
+             * / | \       |
+             * 3 4 5       6
+             */
+
+            this->assert_equals(static_cast<size_t>(7), hierarchy.size());
+            for (size_t i = 0; i < hierarchy.size(); ++i)
+            {
+                this->assert_equals(fixture.preOrder_[i], hierarchy.accessAt(i)->data_);
+            }
+            this->assert_null(hierarchy.accessAt(7));
+
+            auto* root = hierarchy.accessRoot();
+            auto* one = hierarchy.accessSon(*root, 0);
+            auto* two = hierarchy.accessSon(*root, 1);
+            auto* five = hierarchy.accessSon(*one, 2);
+            this->assert_equals(1, one->data_);
+            this->assert_equals(2, two->data_);
+            this->assert_equals(5, five->data_);
+            this->assert_null(hierarchy.accessSon(*two, 1));
+            this->assert_null(hierarchy.accessSon(*five, 0));
+            this->assert_equals(one, hierarchy.accessParent(*five));
+            this->assert_equals(root, hierarchy.accessParent(*two));
+            this->assert_null(hierarchy.accessParent(*root));
+        }
+    };
+
+    /**
+     *  @brief Tests constant-time node count, level, degree and ancestor queries.
+     */
+    class FrozenHierarchyTestLevelCountDegAncestor : public LeafTest
+    {
+    public:
+        FrozenHierarchyTestLevelCountDegAncestor() :
+            LeafTest("level-count-degree-ancestor")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeMWEH();
+            auto hierarchy = amt::freeze(*fixture.hierarchy_);
+
+            auto& root = *hierarchy.accessRoot();
+            auto& one = *hierarchy.accessSon(root, 0);
+            auto& two = *hierarchy.accessSon(root, 1);
+            auto& four = *hierarchy.accessSon(one, 1);
+            auto& six = *hierarchy.accessSon(two, 0);
+
+            this->assert_equals(static_cast<size_t>(7), hierarchy.nodeCount());
+            this->assert_equals(static_cast<size_t>(7), hierarchy.nodeCount(root));
+            this->assert_equals(static_cast<size_t>(4), hierarchy.nodeCount(one));
+            this->assert_equals(static_cast<size_t>(2), hierarchy.nodeCount(two));
+            this->assert_equals(static_cast<size_t>(1), hierarchy.nodeCount(six));
+
+            this->assert_equals(static_cast<size_t>(0), hierarchy.level(root));
+            this->assert_equals(static_cast<size_t>(1), hierarchy.level(two));
+            this->assert_equals(static_cast<size_t>(2), hierarchy.level(four));
+
+            this->assert_equals(static_cast<size_t>(2), hierarchy.degree(root));
+            this->assert_equals(static_cast<size_t>(3), hierarchy.degree(one));
+            this->assert_equals(static_cast<size_t>(0), hierarchy.degree(six));
+
+            this->assert_true(hierarchy.isAncestor(root, six), "Root is an ancestor of every other node.");
+            this->assert_true(hierarchy.isAncestor(one, four), "Parent is an ancestor.");
+            this->assert_false(hierarchy.isAncestor(one, six), "Node from another subtree is not a descendant.");
+            this->assert_false(hierarchy.isAncestor(four, one), "Descendant is not an ancestor.");
+            this->assert_false(hierarchy.isAncestor(two, two), "Node is not its own ancestor.");
+        }
+    };
+
+    /**
+     *  @brief Tests that a subtree is processed as a contiguous slice.
+     */
+    class FrozenHierarchyTestSubtree : public LeafTest
+    {
+    public:
+        FrozenHierarchyTestSubtree() :
+            LeafTest("subtree")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeMWEH();
+            auto hierarchy = amt::freeze(*fixture.hierarchy_);
+            auto& one = *hierarchy.accessSon(*hierarchy.accessRoot(), 0);
+
+            auto expected = std::vector<int>({1, 3, 4, 5});
+            auto actual = std::vector<int>();
+            hierarchy.processPreOrder(&one, [&actual](const auto* node)
+                {
+                    actual.push_back(node->data_);
+                });
+            this->assert_true(expected == actual, "Subtree is visited in pre-order.");
+
+            auto iteratorData = std::vector<int>();
+            for (int data : hierarchy)
+            {
+                iteratorData.push_back(data);
+            }
+            this->assert_true(fixture.preOrder_ == iteratorData, "Iterator visits nodes in pre-order.");
+        }
+    };
+
+    /**
+     *  @brief Tests that the structure of a frozen hierarchy can't be modified.
+     */
+    class FrozenHierarchyTestImmutable : public LeafTest
+    {
+    public:
+        FrozenHierarchyTestImmutable() :
+            LeafTest("immutable")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeMWEH();
+            auto hierarchy = amt::freeze(*fixture.hierarchy_);
+            auto& root = *hierarchy.accessRoot();
+
+            this->assert_throws([&]() { hierarchy.emplaceRoot(); }, "Root can't be emplaced.");
+            this->assert_throws([&]() { hierarchy.changeRoot(nullptr); }, "Root can't be changed.");
+            this->assert_throws([&]() { hierarchy.emplaceSon(root, 0); }, "Son can't be emplaced.");
+            this->assert_throws([&]() { hierarchy.changeSon(root, 0, nullptr); }, "Son can't be changed.");
+            this->assert_throws([&]() { hierarchy.removeSon(root, 0); }, "Son can't be removed.");
+        }
+    };
+
+    /**
+     *  @brief Tests copy constructor, assign and equals.
+     */
+    class FrozenHierarchyTestCopyAssignEquals : public LeafTest
+    {
+    public:
+        FrozenHierarchyTestCopyAssignEquals() :
+            LeafTest("copy-assign-equals")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            auto fixture = details::makeMWEH();
+            auto hierarchy1 = amt::freeze(*fixture.hierarchy_);
+
+            auto hierarchy2(hierarchy1);
+            this->assert_true(hierarchy1.equals(hierarchy2), "Copy constructed hierarchy is the same.");
+            hierarchy2.accessRoot()->data_ = 10;
+            this->assert_false(hierarchy1.equals(hierarchy2), "Modified copy is different.");
+
+            auto& root = *fixture.hierarchy_->accessRoot();
+            fixture.hierarchy_->removeSon(root, 1);
+            auto hierarchy3 = amt::freeze(*fixture.hierarchy_);
+            this->assert_false(hierarchy1.equals(hierarchy3), "Snapshot of a different hierarchy is different.");
+            hierarchy3.assign(hierarchy1);
+            this->assert_true(hierarchy1.equals(hierarchy3), "Assigned hierarchy is the same.");
+
+            hierarchy3.clear();
+            this->assert_true(hierarchy3.isEmpty(), "Cleared hierarchy is empty.");
+        }
+    };
+
+    /**
+     * @brief All FrozenHierarchy tests.
+     */
+    class FrozenHierarchyTest : public CompositeTest
+    {
+    public:
+        FrozenHierarchyTest() :
+            CompositeTest("FrozenHierarchy")
+        {
+            this->add_test(std::make_unique<FrozenHierarchyTestFreeze>());
+            this->add_test(std::make_unique<FrozenHierarchyTestLevelCountDegAncestor>());
+            this->add_test(std::make_unique<FrozenHierarchyTestSubtree>());
+            this->add_test(std::make_unique<FrozenHierarchyTestImmutable>());
+            this->add_test(std::make_unique<FrozenHierarchyTestCopyAssignEquals>());
+        }
+    };
+}
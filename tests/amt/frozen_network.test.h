@@ -0,0 +1,209 @@
+#pragma once
+
+#include <libds/amt/frozen_network.h>
+#include <tests/_details/test.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ds::tests
+{
+    namespace details
+    {
+        /**
+         *  @brief Network used by frozen network tests together with its nodes in gate order.
+         */
+        template<class Network>
+        struct FrozenNetworkFixture
+        {
+            using NodeType = typename Network::NodeType;
+
+            FrozenNetworkFixture()
+            {
+                // 0 - 1 - 2
+                // |     / |
+                // 3 - 4   5    6
+                for (int i = 0; i < 7; ++i)
+                {
+                    nodes_[i] = &network_.insert();
+                    nodes_[i]->data_ = i;
+                }
+                network_.connect(*nodes_[0], *nodes_[1]);
+                network_.connect(*nodes_[1], *nodes_[2]);
+                network_.connect(*nodes_[0], *nodes_[3]);
+                network_.connect(*nodes_[3], *nodes_[4]);
+                network_.connect(*nodes_[2], *nodes_[4]);
+                network_.connect(*nodes_[2], *nodes_[5]);
+            }
+
+            Network network_;
+            NodeType* nodes_[7];
+        };
+    }
+
+    /**
+     *  @brief Tests that freezing preserves nodes, relations and their order.
+     *  @tparam Network Type of the frozen network.
+     */
+    template<class Network>
+    class FrozenNetworkTestFreeze : public LeafTest
+    {
+    public:
+        explicit FrozenNetworkTestFreeze(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const auto emptyNetwork = amt::freeze(Network());
+            this->assert_true(emptyNetwork.isEmpty(), "Frozen empty network is empty.");
+            this->assert_equals(static_cast<size_t>(0), emptyNetwork.relationCount());
+            this->assert_true(emptyNetwork.begin() == emptyNetwork.end(), "Empty network has no nodes to iterate.");
+
+            details::FrozenNetworkFixture<Network> fixture;
+            auto network = amt::freeze(fixture.network_);
+            this->assert_equals(static_cast<size_t>(7), network.size());
+            this->assert_equals(static_cast<size_t>(12), network.relationCount());
+
+            int expectedData = 0;
+            for (auto* node : network)
+            {
+                this->assert_equals(expectedData, node->data_);
+                this->assert_equals(fixture.nodes_[expectedData], network.accessSource(*node));
+                this->assert_equals(fixture.network_.degree(*fixture.nodes_[expectedData]), network.degree(*node));
+                ++expectedData;
+            }
+            this->assert_equals(7, expectedData);
+
+            auto& two = *network.accessNodeFromGate(2);
+            std::vector<int> neighbours;
+            for (auto it = network.beginRelations(two); it != network.endRelations(two); ++it)
+            {
+                neighbours.push_back((*it)->data_);
+            }
+            this->assert_true(neighbours == std::vector<int>({1, 4, 5}), "Relations keep their order.");
+            this->assert_equals(static_cast<size_t>(4), network.calculateRelationIndex(two, 1));
+            this->assert_equals(5, network.accessNodeFromNode(two, 2)->data_);
+            this->assert_null(network.accessNodeFromNode(two, 3));
+            this->assert_null(network.accessNodeFromGate(7));
+
+            auto& six = *network.accessNodeFromGate(6);
+            this->assert_equals(static_cast<size_t>(0), network.degree(six));
+            this->assert_true(network.beginRelations(six) == network.endRelations(six), "Isolated node has no relations.");
+        }
+    };
+
+    /**
+     *  @brief Tests relationExists of a frozen network.
+     *  @tparam Network Type of the frozen network.
+     */
+    template<class Network>
+    class FrozenNetworkTestRelationExists : public LeafTest
+    {
+    public:
+        explicit FrozenNetworkTestRelationExists(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            details::FrozenNetworkFixture<Network> fixture;
+            auto network = amt::freeze(fixture.network_);
+            auto& zero = *network.accessNodeFromGate(0);
+            auto& two = *network.accessNodeFromGate(2);
+            auto& four = *network.accessNodeFromGate(4);
+            auto& six = *network.accessNodeFromGate(6);
+
+            this->assert_true(network.relationExists(two, four), "Relation exists.");
+            this->assert_true(network.relationExists(four, two), "Relation exists in both directions.");
+            this->assert_false(network.relationExists(zero, two), "Missing relation doesn't exist.");
+            this->assert_false(network.relationExists(six, zero), "Isolated node has no relations.");
+        }
+    };
+
+    /**
+     *  @brief Tests that the structure of a frozen network can't be modified.
+     *  @tparam Network Type of the frozen network.
+     */
+    template<class Network>
+    class FrozenNetworkTestImmutable : public LeafTest
+    {
+    public:
+        explicit FrozenNetworkTestImmutable(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            details::FrozenNetworkFixture<Network> fixture;
+            auto network = amt::freeze(fixture.network_);
+            auto& zero = *network.accessNodeFromGate(0);
+            auto& one = *network.accessNodeFromGate(1);
+
+            this->assert_throws([&]() { network.insert(); }, "Node can't be inserted.");
+            this->assert_throws([&]() { network.remove(&zero); }, "Node can't be removed.");
+            this->assert_throws([&]() { network.connect(zero, one); }, "Nodes can't be connected.");
+            this->assert_throws([&]() { network.disconnect(zero, one); }, "Nodes can't be disconnected.");
+        }
+    };
+
+    /**
+     *  @brief Tests copy constructor, assign and equals of a frozen network.
+     *  @tparam Network Type of the frozen network.
+     */
+    template<class Network>
+    class FrozenNetworkTestCopyAssignEquals : public LeafTest
+    {
+    public:
+        explicit FrozenNetworkTestCopyAssignEquals(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            details::FrozenNetworkFixture<Network> fixture;
+            auto network1 = amt::freeze(fixture.network_);
+
+            auto network2(network1);
+            this->assert_true(network1.equals(network2), "Copy constructed network is the same.");
+            network2.accessNodeFromGate(3)->data_ = 10;
+            this->assert_false(network1.equals(network2), "Modified copy is different.");
+
+            fixture.network_.disconnect(*fixture.nodes_[2], *fixture.nodes_[4]);
+            fixture.network_.connect(*fixture.nodes_[2], *fixture.nodes_[3]);
+            auto network3 = amt::freeze(fixture.network_);
+            this->assert_false(network1.equals(network3), "Snapshot with different relations is different.");
+            network3.assign(network1);
+            this->assert_true(network1.equals(network3), "Assigned network is the same.");
+
+            network3.clear();
+            this->assert_true(network3.isEmpty(), "Cleared network is empty.");
+            this->assert_equals(static_cast<size_t>(0), network3.relationCount());
+        }
+    };
+
+    /**
+     * @brief All FrozenNetwork tests.
+     */
+    class FrozenNetworkTest : public CompositeTest
+    {
+    public:
+        FrozenNetworkTest() :
+            CompositeTest("FrozenNetwork")
+        {
+            this->add_test(std::make_unique<FrozenNetworkTestFreeze<amt::IGIRNetwork<int>>>("freeze-igir"));
+            this->add_test(std::make_unique<FrozenNetworkTestFreeze<amt::EGHRNetwork<int>>>("freeze-eghr"));
+            this->add_test(std::make_unique<FrozenNetworkTestRelationExists<amt::IGIRNetwork<int>>>("relation-exists"));
+            this->add_test(std::make_unique<FrozenNetworkTestImmutable<amt::EGERNetwork<int>>>("immutable"));
+            this->add_test(std::make_unique<FrozenNetworkTestCopyAssignEquals<amt::IGERNetwork<int>>>("copy-assign-equals"));
+        }
+    };
+}
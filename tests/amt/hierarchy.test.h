@@ -3,6 +3,7 @@
 #include <tests/_details/test.hpp>
 #include <libds/amt/implicit_hierarchy.h>
 #include <libds/amt/explicit_hierarchy.h>
+#include <libds/amt/frozen_hierarchy.h>
 #include <memory>
 #include <vector>
 
@@ -50,6 +51,36 @@ namespace ds::tests
             };
         };
 
+        /**
+         *         0
+         *    /         \
+         *    1         2
+         *  / | \       |
+         *  3 4 5       6
+         */
+        inline auto const makeMWSEH = []()-> HierarchyFixture<amt::MultiWaySiblingExplicitHierarchy<int>>
+        {
+            auto hierarchy = std::make_unique<amt::MultiWaySiblingExplicitHierarchy<int>>();
+            auto& root = hierarchy->emplaceRoot();
+            auto& two = hierarchy->emplaceSon(root, 0);
+            auto& one = hierarchy->emplaceSon(root, 0);
+            root.data_ = 0;
+            one.data_ = 1;
+            two.data_ = 2;
+            hierarchy->emplaceSon(one, 0).data_ = 5;
+            hierarchy->emplaceSon(one, 0).data_ = 3;
+            hierarchy->emplaceSon(one, 1).data_ = 4;
+            hierarchy->emplaceSon(two, 0).data_ = 6;
+            return
+            {
+                std::move(hierarchy),
+                {0, 1, 3, 4, 5, 2, 6},
+                {3, 4, 5, 1, 6, 2, 0},
+                {0, 1, 2, 3, 4, 5, 6},
+                {}
+            };
+        };
+
         /**
          *         0
          *    /    |    \
@@ -79,6 +110,22 @@ namespace ds::tests
             };
         };
 
+        /**
+         *  Frozen snapshot of the hierarchy from makeKWEH.
+         */
+        inline auto const makeFrozenKWEH = []() -> HierarchyFixture<amt::FrozenHierarchy<int>>
+        {
+            auto fixture = makeKWEH();
+            return
+            {
+                std::make_unique<amt::FrozenHierarchy<int>>(amt::freeze(*fixture.hierarchy_)),
+                std::move(fixture.preOrder_),
+                std::move(fixture.postOrder_),
+                std::move(fixture.levelOrder_),
+                {}
+            };
+        };
+
         /*         10
          *    /          \
          *    5          15
@@ -374,23 +421,35 @@ namespace ds::tests
         {
             using MakeKWEHType = decltype(details::makeKWEH);
             using MakeMWEHType = decltype(details::makeMWEH);
+            using MakeMWSEHType = decltype(details::makeMWSEH);
+            using MakeFrozenKWEHType = decltype(details::makeFrozenKWEH);
             using MakeBIHType = decltype(details::makeBIH);
             using MakeBEHType = decltype(details::makeBEH);
 
             this->add_test(std::make_unique<HierarchyTestProcessPreOrder<MakeKWEHType>>(details::makeKWEH, "process-pre-order-kweh"));
             this->add_test(std::make_unique<HierarchyTestProcessPreOrder<MakeMWEHType>>(details::makeMWEH, "process-pre-order-mweh"));
+            this->add_test(std::make_unique<HierarchyTestProcessPreOrder<MakeMWSEHType>>(details::makeMWSEH, "process-pre-order-mwseh"));
+            this->add_test(std::make_unique<HierarchyTestProcessPreOrder<MakeFrozenKWEHType>>(details::makeFrozenKWEH, "process-pre-order-frozen-kweh"));
             this->add_test(std::make_unique<HierarchyTestProcessPreOrder<MakeBIHType>>(details::makeBIH, "process-pre-order-bih"));
             this->add_test(std::make_unique<HierarchyTestProcessPostOrder<MakeKWEHType>>(details::makeKWEH, "process-post-order-kweh"));
             this->add_test(std::make_unique<HierarchyTestProcessPostOrder<MakeMWEHType>>(details::makeMWEH, "process-post-order-mweh"));
+            this->add_test(std::make_unique<HierarchyTestProcessPostOrder<MakeMWSEHType>>(details::makeMWSEH, "process-post-order-mwseh"));
+            this->add_test(std::make_unique<HierarchyTestProcessPostOrder<MakeFrozenKWEHType>>(details::makeFrozenKWEH, "process-post-order-frozen-kweh"));
             this->add_test(std::make_unique<HierarchyTestProcessPostOrder<MakeBIHType>>(details::makeBIH, "process-post-order-bih"));
             this->add_test(std::make_unique<HierarchyTestProcessLevelOrder<MakeKWEHType>>(details::makeKWEH, "process-level-order-kweh"));
             this->add_test(std::make_unique<HierarchyTestProcessLevelOrder<MakeMWEHType>>(details::makeMWEH, "process-level-order-mweh"));
+            this->add_test(std::make_unique<HierarchyTestProcessLevelOrder<MakeMWSEHType>>(details::makeMWSEH, "process-level-order-mwseh"));
+            this->add_test(std::make_unique<HierarchyTestProcessLevelOrder<MakeFrozenKWEHType>>(details::makeFrozenKWEH, "process-level-order-frozen-kweh"));
             this->add_test(std::make_unique<HierarchyTestProcessLevelOrder<MakeBIHType>>(details::makeBIH, "process-level-order-bih"));
             this->add_test(std::make_unique<HierarchyTestPreOrderIterator<MakeKWEHType>>(details::makeKWEH, "pre-order-iterator-kweh"));
             this->add_test(std::make_unique<HierarchyTestPreOrderIterator<MakeMWEHType>>(details::makeMWEH, "pre-order-iterator-mweh"));
+            this->add_test(std::make_unique<HierarchyTestPreOrderIterator<MakeMWSEHType>>(details::makeMWSEH, "pre-order-iterator-mwseh"));
+            this->add_test(std::make_unique<HierarchyTestPreOrderIterator<MakeFrozenKWEHType>>(details::makeFrozenKWEH, "pre-order-iterator-frozen-kweh"));
             this->add_test(std::make_unique<HierarchyTestPreOrderIterator<MakeBIHType>>(details::makeBIH, "pre-order-iterator-bih"));
             this->add_test(std::make_unique<HierarchyTestPostOrderIterator<MakeKWEHType>>(details::makeKWEH, "post-order-iterator-kweh"));
             this->add_test(std::make_unique<HierarchyTestPostOrderIterator<MakeMWEHType>>(details::makeMWEH, "post-order-iterator-mweh"));
+            this->add_test(std::make_unique<HierarchyTestPostOrderIterator<MakeMWSEHType>>(details::makeMWSEH, "post-order-iterator-mwseh"));
+            this->add_test(std::make_unique<HierarchyTestPostOrderIterator<MakeFrozenKWEHType>>(details::makeFrozenKWEH, "post-order-iterator-frozen-kweh"));
             this->add_test(std::make_unique<HierarchyTestPostOrderIterator<MakeBIHType>>(details::makeBIH, "post-order-iterator-bih"));
             this->add_test(std::make_unique<BinaryHierarchyTestProcessInOrder<MakeBIHType>>(details::makeBIH, "process-in-order-bih"));
             this->add_test(std::make_unique<BinaryHierarchyTestProcessInOrder<MakeBEHType>>(details::makeBEH, "process-in-order-beh"));
@@ -3,7 +3,11 @@
 #include <tests/_details/test.hpp>
 #include <tests/amt/sequence.test.h>
 #include <libds/amt/implicit_sequence.h>
+#include <libds/simd.h>
 #include <memory>
+#include <random>
+#include <string>
+#include <vector>
 
 namespace ds::tests
 {
@@ -67,6 +71,102 @@ namespace ds::tests
         }
     };
 
+    /**
+     *  @brief Tests the simd search kernels with every available instruction set against a naive scan.
+     *  @tparam DataType Type of the data.
+     */
+    template<typename DataType>
+    class ImplicitSequenceTestSearch : public LeafTest
+    {
+    public:
+        explicit ImplicitSequenceTestSearch(const std::string& name) :
+            LeafTest(name)
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            struct Item
+            {
+                DataType key_;
+                char padding_[3];
+            };
+
+            const simd::InstructionSet detected = simd::detectInstructionSet();
+            std::default_random_engine rng(144);
+            std::uniform_int_distribution<int> valueDist(0, 15);
+            bool allMatch = true;
+
+            for (int set = 0; set <= static_cast<int>(detected); ++set)
+            {
+                simd::setInstructionSet(static_cast<simd::InstructionSet>(set));
+                for (size_t size = 0; size <= 80; size += size < 40 ? 1 : 13)
+                {
+                    amt::ImplicitSequence<DataType> seq;
+                    std::vector<DataType> values;
+                    std::vector<Item> items;
+                    for (size_t i = 0; i < size; ++i)
+                    {
+                        values.push_back(this->makeValue(valueDist(rng)));
+                        seq.insertLast().data_ = values.back();
+                        items.push_back({values.back(), {}});
+                    }
+
+                    size_t expectedMin = size > 0 ? 0 : INVALID_INDEX;
+                    size_t expectedMax = expectedMin;
+                    for (size_t i = 1; i < size; ++i)
+                    {
+                        expectedMin = values[i] < values[expectedMin] ? i : expectedMin;
+                        expectedMax = values[expectedMax] < values[i] ? i : expectedMax;
+                    }
+                    allMatch = allMatch && seq.indexOfMin() == expectedMin && seq.indexOfMax() == expectedMax;
+
+                    for (int v = 0; v <= 16; ++v)
+                    {
+                        const DataType value = this->makeValue(v);
+                        size_t expectedIndex = INVALID_INDEX;
+                        size_t expectedCount = 0;
+                        for (size_t i = 0; i < size; ++i)
+                        {
+                            expectedIndex = expectedIndex == INVALID_INDEX && values[i] == value ? i : expectedIndex;
+                            expectedCount += values[i] == value ? 1 : 0;
+                        }
+                        const size_t stridedIndex = size > 0 ? simd::findStrided(&items[0].key_, sizeof(Item), size, value) : INVALID_INDEX;
+                        allMatch = allMatch &&
+                            seq.indexOf(value) == expectedIndex &&
+                            seq.countOf(value) == expectedCount &&
+                            stridedIndex == expectedIndex;
+                    }
+
+                    std::vector<DataType> copy(values);
+                    allMatch = allMatch && simd::equal(values.data(), copy.data(), size);
+                    if (size > 0)
+                    {
+                        copy[size - 1] = this->makeValue(16);
+                        allMatch = allMatch && !simd::equal(values.data(), copy.data(), size);
+                    }
+                }
+            }
+            simd::setInstructionSet(detected);
+
+            this->assert_true(allMatch, "Kernels agree with a naive scan.");
+        }
+
+    private:
+        DataType makeValue(int value)
+        {
+            if constexpr (std::is_pointer_v<DataType>)
+            {
+                return reinterpret_cast<DataType>(static_cast<std::uintptr_t>(value) * 8 + 8);
+            }
+            else
+            {
+                return static_cast<DataType>(value - 8);
+            }
+        }
+    };
+
     /**
      *  @brief All ImplicitSequenceTests.
      */
@@ -77,8 +177,16 @@ namespace ds::tests
             CompositeTest("ImplicitSequence")
         {
             this->add_test(std::make_unique<GenericSequenceTest<amt::ImplicitSequence<int>>>());
+            this->add_test(std::make_unique<SequenceTestEmplaceInPlace<amt::ImplicitSequence>>());
             this->add_test(std::make_unique<ImplicitSequenceTestIndexOfRelative>());
             this->add_test(std::make_unique<CyclicImplicitSequenceTestIndexOfRelative>());
+            this->add_test(std::make_unique<ImplicitSequenceTestSearch<int>>("search-int"));
+            this->add_test(std::make_unique<ImplicitSequenceTestSearch<unsigned char>>("search-unsigned-char"));
+            this->add_test(std::make_unique<ImplicitSequenceTestSearch<short>>("search-short"));
+            this->add_test(std::make_unique<ImplicitSequenceTestSearch<long long>>("search-long-long"));
+            this->add_test(std::make_unique<ImplicitSequenceTestSearch<float>>("search-float"));
+            this->add_test(std::make_unique<ImplicitSequenceTestSearch<double>>("search-double"));
+            this->add_test(std::make_unique<ImplicitSequenceTestSearch<int*>>("search-pointer"));
         }
     };
 }
@@ -3,10 +3,50 @@
 #include <tests/_details/test.hpp>
 #include <libds/amt/sequence.h>
 #include <memory>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 namespace ds::tests
 {
+    namespace details
+    {
+        /**
+         * @brief Data that counts its default constructions and copy assignments.
+         */
+        struct EmplaceCounted
+        {
+            inline static size_t defaultConstructions_ = 0;
+            inline static size_t assignments_ = 0;
+
+            static void resetCounters()
+            {
+                defaultConstructions_ = 0;
+                assignments_ = 0;
+            }
+
+            EmplaceCounted() { ++defaultConstructions_; }
+            EmplaceCounted(int key, int value) : key_(key), value_(value) {}
+            EmplaceCounted(const EmplaceCounted& other) = default;
+
+            EmplaceCounted& operator=(const EmplaceCounted& other)
+            {
+                ++assignments_;
+                key_ = other.key_;
+                value_ = other.value_;
+                return *this;
+            }
+
+            bool operator==(const EmplaceCounted& other) const
+            {
+                return key_ == other.key_ && value_ == other.value_;
+            }
+
+            int key_ = 0;
+            int value_ = 0;
+        };
+    }
+
     /**
      * @brief Tests calculation of elements position.
      * @tparam SequenceT Type of the sequence. Either explicit or implicit.
@@ -730,6 +770,75 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests emplacement at all positions.
+     * @tparam SequenceT Type of the sequence. Either explicit or implicit.
+     */
+    template<class SequenceT>
+    class SequenceTestEmplace : public LeafTest
+    {
+    public:
+        SequenceTestEmplace() :
+            LeafTest("emplace")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            SequenceT seq;
+            seq.emplaceLast(2);
+            seq.emplaceFirst(0);
+            seq.emplaceAfter(*seq.accessFirst(), 1);
+            seq.emplaceAt(seq.size(), 4);
+            seq.emplaceBefore(*seq.accessLast(), 3);
+            this->assert_equals(-1, seq.emplaceAt(0, -1).data_);
+
+            std::vector<int> values;
+            seq.processAllBlocksForward([&values](auto* b)
+                {
+                    values.push_back(b->data_);
+                });
+            this->assert_true(values == std::vector<int>({-1, 0, 1, 2, 3, 4}), "Emplaced elements are in order.");
+        }
+    };
+
+    /**
+     * @brief Tests that emplacement neither default constructs nor assigns the data.
+     * @tparam SequenceTemplate Template of the sequence. Either explicit or implicit.
+     */
+    template<template<typename> class SequenceTemplate>
+    class SequenceTestEmplaceInPlace : public LeafTest
+    {
+    public:
+        SequenceTestEmplaceInPlace() :
+            LeafTest("emplace-in-place")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            using details::EmplaceCounted;
+
+            EmplaceCounted::resetCounters();
+            SequenceTemplate<EmplaceCounted> seq1;
+            for (int i = 0; i < 10; ++i)
+            {
+                seq1.emplaceLast(i, 2 * i);
+            }
+            seq1.emplaceFirst(-1, -2);
+            this->assert_equals(-1, seq1.accessFirst()->data_.key_);
+            this->assert_equals(18, seq1.accessLast()->data_.value_);
+
+            SequenceTemplate<EmplaceCounted> seq2(seq1);
+            this->assert_true(seq1.equals(seq2), "Copy constructed sequence is the same.");
+
+            this->assert_equals(static_cast<size_t>(0), EmplaceCounted::defaultConstructions_);
+            this->assert_equals(static_cast<size_t>(0), EmplaceCounted::assignments_);
+        }
+    };
+
     /**
      * @brief All generic sequence leaf tests.
      * @tparam SequenceT Type of the sequence. Either explicit or implicit.
@@ -760,6 +869,7 @@ namespace ds::tests
             this->add_test(std::make_unique<SequenceTestIterators<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestClear<SequenceT>>());
             this->add_test(std::make_unique<SequenceTestCopyAssignEquals<SequenceT>>());
+            this->add_test(std::make_unique<SequenceTestEmplace<SequenceT>>());
         }
     };
 }
@@ -3,6 +3,8 @@
 #include <tests/_details/test.hpp>
 #include <libds/mm/compact_memory_manager.h>
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace ds::tests
 {
@@ -381,6 +383,120 @@ namespace ds::tests
         }
     };
 
+    /**
+     * @brief Tests sharing and detaching of a copy-on-write buffer.
+     */
+    class CompactMemoryManagerTestCopyOnWrite : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestCopyOnWrite() :
+            LeafTest("copy-on-write")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int n = 10;
+
+            mm::CompactMemoryManager<DummyData> manager1;
+            manager1.setCopyOnWrite(true);
+            for (int i = 0; i < n; ++i)
+            {
+                manager1.allocateMemory()->set_number(i);
+            }
+
+            mm::CompactMemoryManager<DummyData> manager2(manager1);
+            mm::CompactMemoryManager<DummyData> manager3;
+            manager3.assign(manager1);
+            const auto& constManager1 = manager1;
+            const auto& constManager2 = manager2;
+            this->assert_true(manager2.isCopyOnWrite(), "Copy takes over the mode.");
+            this->assert_true(manager1.isShared() && manager2.isShared() && manager3.isShared(), "Copies share the buffer.");
+            this->assert_equals(std::addressof(constManager1.getBlockAt(0)), std::addressof(constManager2.getBlockAt(0)));
+            this->assert_true(manager1.equals(manager3), "Shared buffers are equal.");
+
+            manager2.getBlockAt(3).set_number(-1);
+            this->assert_false(manager2.isShared(), "Written copy is detached.");
+            this->assert_true(manager1.isShared(), "Remaining copies still share.");
+            this->assert_equals(3, constManager1.getBlockAt(3).get_number());
+            this->assert_equals(-1, constManager2.getBlockAt(3).get_number());
+
+            manager3.releaseMemoryAt(0);
+            this->assert_false(manager1.isShared(), "Last sharer owns the buffer.");
+            this->assert_equals(static_cast<std::size_t>(n - 1), manager3.getAllocatedBlockCount());
+            this->assert_equals(1, manager3.getBlockAt(0).get_number());
+            this->assert_equals(static_cast<std::size_t>(n), manager1.getAllocatedBlockCount());
+
+            mm::CompactMemoryManager<DummyData> manager4(manager1);
+            manager4.clear();
+            this->assert_true(manager4.getAllocatedBlockCount() == 0 && !manager4.isShared(), "Cleared copy has its own empty buffer.");
+            this->assert_equals(static_cast<std::size_t>(n), manager1.getAllocatedBlockCount());
+
+            manager1.setCopyOnWrite(false);
+            mm::CompactMemoryManager<DummyData> manager5(manager1);
+            this->assert_false(manager5.isShared(), "Copy without copy-on-write is deep.");
+            this->assert_equals(static_cast<std::size_t>(n), manager5.getAllocatedBlockCount());
+            this->assert_equals(9, manager5.getBlockAt(9).get_number());
+        }
+    };
+
+    /**
+     * @brief Tests copies of a const copy-on-write manager taken and detached on several threads.
+     */
+    class CompactMemoryManagerTestCopyOnWriteThreads : public LeafTest
+    {
+    public:
+        CompactMemoryManagerTestCopyOnWriteThreads() :
+            LeafTest("copy-on-write-threads")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            const int n = 100;
+            const int threadCount = 4;
+            const int rounds = 200;
+
+            mm::CompactMemoryManager<DummyData> manager;
+            manager.setCopyOnWrite(true);
+            for (int i = 0; i < n; ++i)
+            {
+                manager.allocateMemory()->set_number(i);
+            }
+
+            const auto& source = manager;
+            std::vector<int> detached(threadCount, 0);
+            std::vector<std::thread> threads;
+            for (int t = 0; t < threadCount; ++t)
+            {
+                threads.emplace_back([&source, &detached, t]()
+                {
+                    for (int r = 0; r < rounds; ++r)
+                    {
+                        mm::CompactMemoryManager<DummyData> copy(source);
+                        copy.getBlockAt(0).set_number(-1);
+                        detached[t] += !copy.isShared() && copy.getBlockAt(n - 1).get_number() == n - 1;
+                    }
+                });
+            }
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+
+            bool allDetached = true;
+            for (int count : detached)
+            {
+                allDetached = allDetached && count == rounds;
+            }
+            this->assert_true(allDetached, "Every copy detached with the source's data.");
+            this->assert_false(manager.isShared(), "Source owns its buffer again.");
+            this->assert_equals(0, source.getBlockAt(0).get_number());
+        }
+    };
+
     /**
      * @brief All CompactMemoryManager leaf tests.
      */
@@ -401,6 +517,8 @@ namespace ds::tests
             this->add_test(std::make_unique<CompactMemoryManagerTestCalculateAddress>());
             this->add_test(std::make_unique<CompactMemoryManagerTestCalculateIndex>());
             this->add_test(std::make_unique<CompactMemoryManagerSwap>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestCopyOnWrite>());
+            this->add_test(std::make_unique<CompactMemoryManagerTestCopyOnWriteThreads>());
         }
     };
 }
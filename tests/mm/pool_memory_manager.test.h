@@ -0,0 +1,98 @@
+#pragma once
+
+#include <tests/_details/test.hpp>
+#include <libds/mm/pool_memory_manager.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ds::tests
+{
+    /**
+     * @brief Tests that the pool grows by whole chunks and keeps its blocks apart.
+     */
+    class PoolMemoryManagerTestAllocate : public LeafTest
+    {
+    public:
+        PoolMemoryManagerTestAllocate() :
+            LeafTest("allocate")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::PoolMemoryManager<std::string> manager(4);
+            std::vector<std::string*> blocks;
+            for (int i = 0; i < 20; ++i)
+            {
+                blocks.push_back(manager.emplaceMemory(std::to_string(i)));
+            }
+
+            this->assert_equals(static_cast<std::size_t>(20), manager.getAllocatedBlockCount());
+            this->assert_equals(static_cast<std::size_t>(4 + 8 + 16), manager.getCapacity());
+
+            auto intact = true;
+            for (int i = 0; i < 20; ++i)
+            {
+                intact = intact && *blocks[i] == std::to_string(i);
+            }
+            this->assert_true(intact, "Blocks keep their data.");
+
+            for (auto* block : blocks)
+            {
+                manager.releaseMemory(block);
+            }
+            this->assert_equals(static_cast<std::size_t>(0), manager.getAllocatedBlockCount());
+        }
+    };
+
+    /**
+     * @brief Tests that released blocks are reused before the pool grows.
+     */
+    class PoolMemoryManagerTestReuse : public LeafTest
+    {
+    public:
+        PoolMemoryManagerTestReuse() :
+            LeafTest("reuse")
+        {
+        }
+
+    protected:
+        void test() override
+        {
+            mm::PoolMemoryManager<int> manager(8);
+            int* first = manager.allocateMemory();
+            int* second = manager.allocateMemory();
+            manager.releaseMemory(first);
+            manager.releaseMemory(second);
+
+            this->assert_true(manager.allocateMemory() == second, "The last released block is reused first.");
+            this->assert_true(manager.allocateMemory() == first, "Then the block released before it.");
+
+            for (int i = 0; i < 1'000; ++i)
+            {
+                manager.releaseMemory(manager.allocateMemory());
+            }
+            this->assert_equals(static_cast<std::size_t>(8), manager.getCapacity());
+            this->assert_equals(static_cast<std::size_t>(2), manager.getAllocatedBlockCount());
+
+            manager.releaseMemory(first);
+            manager.releaseMemory(second);
+        }
+    };
+
+    /**
+     * @brief All pool memory manager tests.
+     */
+    class PoolMemoryManagerTest : public CompositeTest
+    {
+    public:
+        PoolMemoryManagerTest() :
+            CompositeTest("PoolMemoryManager")
+        {
+            this->add_test(std::make_unique<PoolMemoryManagerTestAllocate>());
+            this->add_test(std::make_unique<PoolMemoryManagerTestReuse>());
+        }
+    };
+}